@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QObject>
+#include <QRandomGenerator>
+#include <QTest>
+
+#include <functional>
+
+#include "pairings/matching.h"
+
+class MatchingTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testEmptyGraph();
+    void testWeights();
+    void testMaximumCardinality();
+    void testBlossom();
+    void testRandomGraphs_data();
+    void testRandomGraphs();
+    void benchmarkDenseGraph_data();
+    void benchmarkDenseGraph();
+};
+
+void MatchingTest::testEmptyGraph()
+{
+    MatchingGraph graph{3};
+    graph.build();
+
+    MaximumWeightMatching matching;
+    const auto &mates = matching.solve(graph);
+
+    QCOMPARE(mates, std::vector<int>({-1, -1, -1}));
+    QCOMPARE(matching.size(), 0);
+}
+
+void MatchingTest::testWeights()
+{
+    // Path 0 - 1 - 2 - 3: the heavy middle edge is better than both outer edges
+    MatchingGraph graph{4};
+    graph.addEdge(0, 1, 2);
+    graph.addEdge(1, 2, 5);
+    graph.addEdge(2, 3, 2);
+    graph.build();
+
+    MaximumWeightMatching matching;
+    QCOMPARE(matching.solve(graph), std::vector<int>({-1, 2, 1, -1}));
+}
+
+void MatchingTest::testMaximumCardinality()
+{
+    MatchingGraph graph{4};
+    graph.addEdge(0, 1, 2);
+    graph.addEdge(1, 2, 5);
+    graph.addEdge(2, 3, 2);
+    graph.build();
+
+    MaximumWeightMatching matching;
+    QCOMPARE(matching.solve(graph, true), std::vector<int>({1, 0, 3, 2}));
+    QCOMPARE(matching.size(), 2);
+}
+
+void MatchingTest::testBlossom()
+{
+    // Odd cycle 0 - 1 - 2 with a tail at each vertex
+    MatchingGraph graph{6};
+    graph.addEdge(0, 1, 8);
+    graph.addEdge(1, 2, 8);
+    graph.addEdge(2, 0, 8);
+    graph.addEdge(0, 3, 5);
+    graph.addEdge(1, 4, 5);
+    graph.addEdge(2, 5, 5);
+    graph.build();
+
+    MaximumWeightMatching matching;
+    QCOMPARE(matching.solve(graph, true), std::vector<int>({3, 4, 5, 0, 1, 2}));
+}
+
+void MatchingTest::testRandomGraphs_data()
+{
+    QTest::addColumn<bool>("maximumCardinality");
+
+    QTest::newRow("maximum weight") << false;
+    QTest::newRow("maximum cardinality") << true;
+}
+
+void MatchingTest::testRandomGraphs()
+{
+    QFETCH(bool, maximumCardinality);
+
+    QRandomGenerator random{42};
+    MaximumWeightMatching matching;
+
+    for (int iteration = 0; iteration < 500; ++iteration) {
+        const int n = random.bounded(1, 9);
+        const int density = random.bounded(100);
+
+        std::vector<std::vector<std::int64_t>> weights(n, std::vector<std::int64_t>(n, -1));
+        MatchingGraph graph{n};
+        for (int i = 0; i < n; ++i) {
+            for (int j = i + 1; j < n; ++j) {
+                if (random.bounded(100) < density) {
+                    weights[i][j] = weights[j][i] = random.bounded(20);
+                    graph.addEdge(i, j, weights[i][j]);
+                }
+            }
+        }
+        graph.build();
+
+        const auto &mates = matching.solve(graph, maximumCardinality);
+
+        std::int64_t weight = 0;
+        for (int v = 0; v < n; ++v) {
+            if (mates[v] >= 0) {
+                QCOMPARE(mates[mates[v]], v);
+                QVERIFY(weights[v][mates[v]] >= 0);
+                weight += v < mates[v] ? weights[v][mates[v]] : 0;
+            }
+        }
+
+        // Brute force
+        std::pair<int, std::int64_t> best{-1, -1};
+        std::vector<bool> used(n, false);
+        std::function<void(int, int, std::int64_t)> search = [&](int i, int edges, std::int64_t total) {
+            while (i < n && used[i]) {
+                ++i;
+            }
+            if (i == n) {
+                const auto value = maximumCardinality ? std::pair{edges, total} : std::pair{0, total};
+                best = std::max(best, value);
+                return;
+            }
+            used[i] = true;
+            search(i + 1, edges, total);
+            for (int j = i + 1; j < n; ++j) {
+                if (!used[j] && weights[i][j] >= 0) {
+                    used[j] = true;
+                    search(i + 1, edges + 1, total + weights[i][j]);
+                    used[j] = false;
+                }
+            }
+            used[i] = false;
+        };
+        search(0, 0, 0);
+
+        QCOMPARE(weight, best.second);
+        if (maximumCardinality) {
+            QCOMPARE(matching.size(), best.first);
+        }
+    }
+}
+
+void MatchingTest::benchmarkDenseGraph_data()
+{
+    QTest::addColumn<int>("vertices");
+
+    QTest::newRow("100") << 100;
+    QTest::newRow("400") << 400;
+}
+
+void MatchingTest::benchmarkDenseGraph()
+{
+    QFETCH(int, vertices);
+
+    // Score-group like graph: most pairs are allowed, closer ranks weigh more
+    QRandomGenerator random(static_cast<quint32>(vertices));
+    MatchingGraph graph{vertices};
+    graph.reserve(vertices, static_cast<std::size_t>(vertices) * vertices / 2);
+    for (int i = 0; i < vertices; ++i) {
+        for (int j = i + 1; j < vertices; ++j) {
+            if (random.bounded(10) < 9) {
+                graph.addEdge(i, j, 2 * vertices - (j - i));
+            }
+        }
+    }
+    graph.build();
+
+    MaximumWeightMatching matching;
+    QBENCHMARK {
+        matching.solve(graph, true);
+    }
+    QCOMPARE(matching.size(), vertices / 2);
+}
+
+QTEST_GUILESS_MAIN(MatchingTest)
+
+#include "matchingtest.moc"
@@ -0,0 +1,501 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QTest>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "event.h"
+#include "pairings/pairingcache.h"
+#include "pairings/pairingchecker.h"
+#include "pairings/builtinbackend.h"
+#include "pairings/pairingsnapshot.h"
+#include "pairings/roundrobin.h"
+#include "pairings/speculativepairing.h"
+#include "pairings/swiss.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class PairingsTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testFirstRound();
+    void testStoredPairings_data();
+    void testStoredPairings();
+    void testBursteinPairings();
+    void testDubovPairings();
+    void testLimPairings();
+    void testValidPairings_data();
+    void testValidPairings();
+    void testBye();
+    void testNoValidPairing();
+    void testSnapshotHash();
+    void testPairingCacheKey();
+    void testSpeculativePairing();
+    void testPairingChecker();
+    void testBergerTables();
+    void testRoundRobin_data();
+    void testRoundRobin();
+};
+
+void PairingsTest::testFirstRound()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1String(DATA_DIR) + u"/tournament_1.txt"_s);
+    QVERIFY(tournament.has_value());
+
+    const auto snapshot = PairingSnapshot::fromTournament(*tournament, 1);
+
+    SwissPairingEngine engine;
+    const auto pairs = engine.pair(snapshot);
+    QVERIFY(pairs.has_value());
+
+    QSet<std::pair<int, int>> expected;
+    for (const auto &pairing : (*tournament)->pairings(1)) {
+        expected.insert({pairing->whitePlayer()->startingRank() - 1, pairing->blackPlayer()->startingRank() - 1});
+    }
+
+    QCOMPARE(QSet<std::pair<int, int>>(pairs->cbegin(), pairs->cend()), expected);
+}
+
+void PairingsTest::testStoredPairings_data()
+{
+    QTest::addColumn<int>("round");
+
+    for (int i = 1; i <= 9; ++i) {
+        QTest::addRow("round %d", i) << i;
+    }
+}
+
+void PairingsTest::testStoredPairings()
+{
+    QFETCH(int, round);
+
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1String(DATA_DIR) + u"/tournament_1.txt"_s);
+    QVERIFY(tournament.has_value());
+
+    const auto snapshot = PairingSnapshot::fromTournament(*tournament, round);
+
+    SwissPairingEngine engine;
+    const auto pairs = engine.pair(snapshot);
+    QVERIFY(pairs.has_value());
+
+    // The tournament was paired with the Dutch system, so every round must match
+    QSet<std::pair<int, int>> expected;
+    for (const auto &pairing : (*tournament)->pairings(round)) {
+        if (pairing->blackPlayer() != nullptr) {
+            expected.insert({pairing->whitePlayer()->startingRank() - 1, pairing->blackPlayer()->startingRank() - 1});
+        } else if (!Pairing::isVoluntaryBye(pairing->whiteResult())) {
+            expected.insert({pairing->whitePlayer()->startingRank() - 1, -1});
+        }
+    }
+
+    QCOMPARE(QSet<std::pair<int, int>>(pairs->cbegin(), pairs->cend()), expected);
+}
+
+void PairingsTest::testBursteinPairings()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1String(DATA_DIR) + u"/burstein_1.trf"_s);
+    QVERIFY(tournament.has_value());
+
+    const auto snapshot = PairingSnapshot::fromTournament(*tournament, 3);
+
+    SwissPairingEngine engine{SwissPairingEngine::System::Burstein};
+    const auto pairs = engine.pair(snapshot);
+    QVERIFY(pairs.has_value());
+
+    // Players 1, 3, 6 and 8 have 1 point and played white and then black, so
+    // every pair of them violates one color preference. Sorted by Buchholz and
+    // Sonneborn-Berger they are 6 (3, 1.5), 1 (2, 0.5), 3 (2, 0.5) and 8 (1, 0.5),
+    // and the first one is paired against the last one. The Dutch system would
+    // pair 1-6 and 3-8 instead.
+    const QSet<std::pair<int, int>> expected{{4, 1}, {5, 7}, {0, 2}, {6, 3}};
+    QCOMPARE(QSet<std::pair<int, int>>(pairs->cbegin(), pairs->cend()), expected);
+}
+
+void PairingsTest::testDubovPairings()
+{
+    PairingSnapshot snapshot{8, 5};
+    for (int i = 0; i < 8; ++i) {
+        snapshot.setRating(i, 2200 - 50 * i);
+    }
+
+    // 1-5 0-1, 6-2 0-1, 3-7 1-0, 8-4 0-1
+    const auto round = snapshot.addRound();
+    snapshot.setGame(round, 0, 4, Pairing::PartialResult::Lost, Pairing::PartialResult::Win);
+    snapshot.setGame(round, 5, 1, Pairing::PartialResult::Lost, Pairing::PartialResult::Win);
+    snapshot.setGame(round, 2, 6, Pairing::PartialResult::Win, Pairing::PartialResult::Lost);
+    snapshot.setGame(round, 7, 3, Pairing::PartialResult::Lost, Pairing::PartialResult::Win);
+
+    SwissPairingEngine engine{SwissPairingEngine::System::Dubov};
+    const auto pairs = engine.pair(snapshot);
+    QVERIFY(pairs.has_value());
+
+    // Winners: 2, 4 and 5 seek white and 3 seeks black, so the lowest ranked
+    // white seeker, 5, moves to the black seekers. White seekers are sorted by the
+    // average rating of their opponents, so 4 (who played 8) comes before 2 (who
+    // played 6), and black seekers by rating, 3 before 5: 4-3 and 2-5.
+    // Losers: 7 seeks white and 1, 6 and 8 seek black, so 8 moves to the white
+    // seekers and comes before 7, because 4 is rated lower than 3: 8-1 and 7-6.
+    const QSet<std::pair<int, int>> expected{{3, 2}, {1, 4}, {7, 0}, {6, 5}};
+    QCOMPARE(QSet<std::pair<int, int>>(pairs->cbegin(), pairs->cend()), expected);
+}
+
+void PairingsTest::testLimPairings()
+{
+    PairingSnapshot snapshot{8, 5};
+    for (int i = 0; i < 8; ++i) {
+        snapshot.setRating(i, 2200 - 50 * i);
+    }
+
+    // 1-5 1-0, 6-2 0-1, 3-7 1/2, 8-4 0-1
+    const auto round = snapshot.addRound();
+    snapshot.setGame(round, 0, 4, Pairing::PartialResult::Win, Pairing::PartialResult::Lost);
+    snapshot.setGame(round, 5, 1, Pairing::PartialResult::Lost, Pairing::PartialResult::Win);
+    snapshot.setGame(round, 2, 6, Pairing::PartialResult::Draw, Pairing::PartialResult::Draw);
+    snapshot.setGame(round, 7, 3, Pairing::PartialResult::Lost, Pairing::PartialResult::Win);
+
+    SwissPairingEngine engine{SwissPairingEngine::System::Lim};
+    const auto pairs = engine.pair(snapshot);
+    QVERIFY(pairs.has_value());
+
+    // The median group is {3, 7}, with half of the points played. The top group
+    // pairs 2-1 and floats 4 down, and the bottom group pairs 5-6 and floats 8 up.
+    // The median group is paired last: 3 and 7 already played, so 4-3 and 7-8.
+    // The Dutch system would float 7 down from the median group instead.
+    const QSet<std::pair<int, int>> expected{{1, 0}, {3, 2}, {4, 5}, {6, 7}};
+    QCOMPARE(QSet<std::pair<int, int>>(pairs->cbegin(), pairs->cend()), expected);
+}
+
+void PairingsTest::testValidPairings_data()
+{
+    QTest::addColumn<int>("system");
+    QTest::addColumn<int>("round");
+
+    const std::pair<SwissPairingEngine::System, const char *> systems[] = {
+        {SwissPairingEngine::System::Dutch, "dutch"},
+        {SwissPairingEngine::System::Burstein, "burstein"},
+        {SwissPairingEngine::System::Dubov, "dubov"},
+        {SwissPairingEngine::System::Lim, "lim"},
+    };
+
+    for (const auto &[system, name] : systems) {
+        for (int i = 1; i <= 9; ++i) {
+            QTest::addRow("%s round %d", name, i) << std::to_underlying(system) << i;
+        }
+    }
+}
+
+void PairingsTest::testValidPairings()
+{
+    QFETCH(int, system);
+    QFETCH(int, round);
+
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1String(DATA_DIR) + u"/tournament_1.txt"_s);
+    QVERIFY(tournament.has_value());
+
+    const auto snapshot = PairingSnapshot::fromTournament(*tournament, round);
+
+    SwissPairingEngine engine{SwissPairingEngine::System(system)};
+    const auto pairs = engine.pair(snapshot);
+    QVERIFY(pairs.has_value());
+    QVERIFY(engine.solvedMatchings() > 0);
+
+    QSet<int> paired;
+    int byes = 0;
+    for (const auto &[white, black] : *pairs) {
+        QVERIFY(snapshot.isAvailable(white));
+        QVERIFY(!paired.contains(white));
+        paired.insert(white);
+
+        if (black < 0) {
+            ++byes;
+            for (int r = 0; r < snapshot.playedRounds(); ++r) {
+                QVERIFY(snapshot.result(white, r) != Pairing::PartialResult::PairingBye);
+            }
+            continue;
+        }
+
+        QVERIFY(snapshot.isAvailable(black));
+        QVERIFY(!paired.contains(black));
+        paired.insert(black);
+
+        for (int r = 0; r < snapshot.playedRounds(); ++r) {
+            QVERIFY(!(snapshot.hasPlayed(white, r) && snapshot.opponent(white, r) == black));
+        }
+    }
+
+    int available = 0;
+    for (int i = 0; i < snapshot.numberOfPlayers(); ++i) {
+        available += snapshot.isAvailable(i) ? 1 : 0;
+    }
+    QCOMPARE(static_cast<int>(paired.size()), available);
+    QCOMPARE(byes, available % 2);
+}
+
+void PairingsTest::testBye()
+{
+    PairingSnapshot snapshot{3, 3};
+
+    SwissPairingEngine engine;
+    const auto pairs = engine.pair(snapshot);
+    QVERIFY(pairs.has_value());
+    QCOMPARE(static_cast<int>(pairs->size()), 2);
+
+    // The lowest player receives the bye
+    QVERIFY(std::ranges::find(*pairs, std::pair{2, -1}) != pairs->cend());
+
+    // Player 3 already received the pairing-allocated bye
+    const auto round = snapshot.addRound();
+    snapshot.setGame(round, 0, 1, Pairing::PartialResult::Draw, Pairing::PartialResult::Draw);
+    snapshot.setBye(round, 2, Pairing::PartialResult::PairingBye);
+
+    const auto next = engine.pair(snapshot);
+    QVERIFY(next.has_value());
+    QVERIFY(std::ranges::find(*next, std::pair{1, -1}) != next->cend() || std::ranges::find(*next, std::pair{0, -1}) != next->cend());
+    QVERIFY(std::ranges::find(*next, std::pair{2, -1}) == next->cend());
+}
+
+void PairingsTest::testNoValidPairing()
+{
+    PairingSnapshot snapshot{2, 2};
+
+    const auto round = snapshot.addRound();
+    snapshot.setGame(round, 0, 1, Pairing::PartialResult::Win, Pairing::PartialResult::Lost);
+
+    SwissPairingEngine engine;
+    QVERIFY(!engine.pair(snapshot).has_value());
+}
+
+void PairingsTest::testSnapshotHash()
+{
+    PairingSnapshot snapshot{4, 3};
+    auto round = snapshot.addRound();
+    snapshot.setGame(round, 0, 2, Pairing::PartialResult::Win, Pairing::PartialResult::Lost);
+    snapshot.setGame(round, 3, 1, Pairing::PartialResult::Draw, Pairing::PartialResult::Draw);
+
+    PairingSnapshot other{4, 3};
+    round = other.addRound();
+    other.setGame(round, 0, 2, Pairing::PartialResult::Win, Pairing::PartialResult::Lost);
+    other.setGame(round, 3, 1, Pairing::PartialResult::Draw, Pairing::PartialResult::Draw);
+
+    QCOMPARE(snapshot.hash(), other.hash());
+
+    other.setResult(round, 3, Pairing::PartialResult::Win);
+    other.setResult(round, 1, Pairing::PartialResult::Lost);
+    QVERIFY(snapshot.hash() != other.hash());
+
+    PairingSnapshot black{4, 3, Pairing::Color::Black};
+    round = black.addRound();
+    black.setGame(round, 0, 2, Pairing::PartialResult::Win, Pairing::PartialResult::Lost);
+    black.setGame(round, 3, 1, Pairing::PartialResult::Draw, Pairing::PartialResult::Draw);
+    QVERIFY(snapshot.hash() != black.hash());
+}
+
+void PairingsTest::testPairingCacheKey()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1String(DATA_DIR) + u"/tournament_1.txt"_s);
+    QVERIFY(tournament.has_value());
+
+    const auto snapshot = PairingSnapshot::fromTournament(*tournament, 2);
+    const auto key = PairingCache::key(snapshot, Tournament::PairingSystem::Dutch, Tournament::PairingEngine::BuiltIn);
+
+    QCOMPARE(key, PairingCache::key(PairingSnapshot::fromTournament(*tournament, 2), Tournament::PairingSystem::Dutch, Tournament::PairingEngine::BuiltIn));
+    QVERIFY(key != PairingCache::key(PairingSnapshot::fromTournament(*tournament, 3), Tournament::PairingSystem::Dutch, Tournament::PairingEngine::BuiltIn));
+    QVERIFY(key != PairingCache::key(snapshot, Tournament::PairingSystem::Dubov, Tournament::PairingEngine::BuiltIn));
+    QVERIFY(key != PairingCache::key(snapshot, Tournament::PairingSystem::Dutch, Tournament::PairingEngine::BbpPairings));
+}
+
+void PairingsTest::testSpeculativePairing()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1String(DATA_DIR) + u"/tournament_1.txt"_s);
+    QVERIFY(tournament.has_value());
+
+    auto t = *tournament;
+    t->setNumberOfRounds(10);
+    t->setCurrentRound(9);
+
+    // Leave the first two games of the last round pending
+    const auto pairings = t->pairings(9);
+    const Pairing::Result first = {pairings[0]->whiteResult(), pairings[0]->blackResult()};
+    const Pairing::Result second = {pairings[1]->whiteResult(), pairings[1]->blackResult()};
+    pairings[0]->setResult({Pairing::PartialResult::Unknown, Pairing::PartialResult::Unknown});
+    pairings[1]->setResult({Pairing::PartialResult::Unknown, Pairing::PartialResult::Unknown});
+
+    SpeculativePairing speculation;
+    speculation.update(t);
+
+    // Another outcome of the first game
+    const Pairing::Result other = first.first == Pairing::PartialResult::Win
+        ? Pairing::Result{Pairing::PartialResult::Draw, Pairing::PartialResult::Draw}
+        : Pairing::Result{Pairing::PartialResult::Win, Pairing::PartialResult::Lost};
+    pairings[0]->setResult(other);
+    pairings[1]->setResult(second);
+    const auto otherKey = PairingCache::key(PairingSnapshot::fromTournament(t, 10), t->pairingSystem(), Tournament::PairingEngine::BuiltIn);
+
+    pairings[0]->setResult(first);
+
+    const auto snapshot = PairingSnapshot::fromTournament(t, 10);
+    const auto key = PairingCache::key(snapshot, t->pairingSystem(), Tournament::PairingEngine::BuiltIn);
+    QTRY_VERIFY(speculation.result(key).has_value());
+    QTRY_VERIFY(speculation.result(otherKey).has_value());
+
+    SwissPairingEngine engine{BuiltInPairingBackend::engineSystem(t->pairingSystem())};
+    const auto expected = engine.pair(snapshot);
+    QVERIFY(expected.has_value());
+    QCOMPARE(*speculation.result(key), BuiltInPairingBackend::toStartingRanks(*expected));
+
+    // Entering the results drops the scenarios that can no longer happen
+    speculation.update(t);
+    QVERIFY(speculation.result(key).has_value());
+    QVERIFY(!speculation.result(otherKey).has_value());
+
+    // Too many pending games for the budget
+    speculation.setMaxScenarios(8);
+    pairings[0]->setResult({Pairing::PartialResult::Unknown, Pairing::PartialResult::Unknown});
+    pairings[1]->setResult({Pairing::PartialResult::Unknown, Pairing::PartialResult::Unknown});
+    speculation.update(t);
+    QVERIFY(!speculation.result(key).has_value());
+
+    // Not enough memory for the scenarios
+    speculation.setMaxScenarios(243);
+    speculation.setMaxMemory(1024);
+    speculation.update(t);
+    pairings[0]->setResult(first);
+    pairings[1]->setResult(second);
+    QVERIFY(!speculation.result(key).has_value());
+}
+
+void PairingsTest::testPairingChecker()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1String(DATA_DIR) + u"/tournament_1.txt"_s);
+    QVERIFY(tournament.has_value());
+
+    auto t = *tournament;
+
+    PairingChecker checker;
+    auto reports = checker.check(t);
+    QCOMPARE(reports.size(), t->currentRound());
+
+    for (int i = 0; i < reports.size(); ++i) {
+        QCOMPARE(reports[i].round, i + 1);
+        QVERIFY2(reports[i].error.isEmpty(), qPrintable(reports[i].error));
+        QVERIFY(reports[i].matches());
+    }
+
+    // Swap the colors of the first board
+    auto pairing = t->pairings(1).constFirst();
+    const auto white = pairing->whitePlayer();
+    pairing->setWhitePlayer(pairing->blackPlayer());
+    pairing->setBlackPlayer(white);
+
+    reports = checker.check(t);
+    QVERIFY(!reports[0].matches());
+    QCOMPARE(reports[0].unexpected.size(), 1);
+    QCOMPARE(reports[0].missing.size(), 1);
+    QCOMPARE(reports[0].unexpected[0].first, reports[0].missing[0].second);
+}
+
+void PairingsTest::testBergerTables()
+{
+    static_assert(BergerTables::numberOfRounds(6) == 5);
+    static_assert(BergerTables::numberOfRounds(5) == 5);
+    static_assert(BergerTables::numberOfRounds(6, true) == 10);
+    static_assert(BergerTables::pairing(6, 0, 0) == std::pair{0, 5});
+
+    // FIDE Berger table for 6 players, round 2: 6-4, 5-3, 1-2
+    const BergerTables::Pairs expected{{5, 3}, {4, 2}, {0, 1}};
+    QCOMPARE(BergerTables::pairings(6, 1), expected);
+
+    // With 5 players, the player paired with the sixth one does not play
+    const BergerTables::Pairs withBye{{4, 2}, {0, 1}, {3, -1}};
+    QCOMPARE(BergerTables::pairings(5, 1), withBye);
+
+    // The second cycle reverses the colors
+    const BergerTables::Pairs reversed{{3, 5}, {2, 4}, {1, 0}};
+    QCOMPARE(BergerTables::pairings(6, 6, true), reversed);
+}
+
+void PairingsTest::testRoundRobin_data()
+{
+    QTest::addColumn<int>("players");
+    QTest::addColumn<bool>("doubleRoundRobin");
+
+    for (const auto players : {3, 4, 9, 14, 19, 20, 21, 30}) {
+        QTest::addRow("%d players", players) << players << false;
+        QTest::addRow("%d players, double", players) << players << true;
+    }
+}
+
+void PairingsTest::testRoundRobin()
+{
+    QFETCH(int, players);
+    QFETCH(bool, doubleRoundRobin);
+
+    // Games with white for each pair of players
+    std::vector<int> games(static_cast<std::size_t>(players * players), 0);
+    std::vector<int> byes(static_cast<std::size_t>(players), 0);
+
+    for (int round = 0; round < BergerTables::numberOfRounds(players, doubleRoundRobin); ++round) {
+        QSet<int> paired;
+        for (const auto &[white, black] : BergerTables::pairings(players, round, doubleRoundRobin)) {
+            QVERIFY(!paired.contains(white));
+            paired << white;
+
+            if (black < 0) {
+                byes[white]++;
+                continue;
+            }
+
+            QVERIFY(!paired.contains(black));
+            paired << black;
+            games[white * players + black]++;
+        }
+        QCOMPARE(paired.size(), players);
+    }
+
+    const auto cycles = doubleRoundRobin ? 2 : 1;
+    for (int i = 0; i < players; ++i) {
+        QCOMPARE(byes[i], players % 2 * cycles);
+        for (int j = 0; j < players; ++j) {
+            if (i == j) {
+                continue;
+            }
+            QCOMPARE(games[i * players + j] + games[j * players + i], cycles);
+            if (doubleRoundRobin) {
+                QCOMPARE(games[i * players + j], 1);
+            }
+        }
+    }
+}
+
+QTEST_GUILESS_MAIN(PairingsTest)
+
+#include "pairingstest.moc"
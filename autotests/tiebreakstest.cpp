@@ -6,9 +6,18 @@
 #include <QString>
 #include <QTest>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
 #include "event.h"
+#include "incrementalstandings.h"
+#include "pairing.h"
 #include "standing.h"
 #include "state.h"
+#include "tiebreaks/performance.h"
+#include "tiebreaks/points.h"
 #include "tournament.h"
 
 using namespace Qt::Literals::StringLiterals;
@@ -24,6 +33,17 @@ private Q_SLOTS:
 
     void testTiebreaks_data();
     void testTiebreaks();
+    void testIncrementalStandings();
+    void testStateCutOff_data();
+    void testStateCutOff();
+    void testCompiledTiebreaks();
+    void testCalculateGroup();
+    void testStandingKey();
+    void testStandingsHistory();
+    void testOpponentScores();
+    void testPerformance();
+    void testDirectEncounter();
+    void testProgressiveTiebreaks();
 };
 
 QList<QStringList> TiebreaksTest::readStandings(const QString &fileName)
@@ -105,6 +125,549 @@ void TiebreaksTest::testTiebreaks()
     }
 }
 
+void TiebreaksTest::testIncrementalStandings()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1StringView(DATA_DIR) + "/tournament_1.txt"_L1);
+    QVERIFY(tournament.has_value());
+
+    auto t = *tournament;
+    QVERIFY(t->setTiebreaksFromTrf(u"pts,bh/c1,aob,win"_s));
+
+    IncrementalStandings incremental;
+    incremental.setTournament(t);
+    incremental.setStandings(t->numberOfRounds(), t->standings(t->state()));
+    QVERIFY(incremental.isValid());
+
+    const QList<Pairing::Result> results{
+        {Pairing::PartialResult::Lost, Pairing::PartialResult::Win},
+        {Pairing::PartialResult::Draw, Pairing::PartialResult::Draw},
+        {Pairing::PartialResult::Win, Pairing::PartialResult::Lost},
+    };
+
+    int changes = 0;
+    for (int round = 1; round <= t->currentRound(); ++round) {
+        const auto pairings = t->pairings(round);
+        for (int i = 0; i < pairings.size(); i += 3) {
+            const auto pairing = pairings.at(i);
+            if (pairing->blackPlayer() == nullptr) {
+                continue;
+            }
+
+            QVERIFY(t->setResult(pairing, results.at(changes++ % results.size())));
+            QVERIFY(incremental.isValid());
+
+            // The full computation is the reference
+            const auto expected = t->standings(t->state());
+            const auto standings = incremental.standings();
+            QCOMPARE(standings.size(), expected.size());
+            for (qsizetype j = 0; j < standings.size(); ++j) {
+                QCOMPARE(standings.at(j).player(), expected.at(j).player());
+                QCOMPARE(standings.at(j).rank(), expected.at(j).rank());
+                QCOMPARE(standings.at(j).values(), expected.at(j).values());
+            }
+        }
+    }
+    QVERIFY(changes > 0);
+
+    // Tiebreaks are read when the standings are seeded
+    QVERIFY(t->setTiebreaksFromTrf(u"pts,bh"_s));
+    QVERIFY(!incremental.updateResult(t->pairings(1).constFirst()));
+    QVERIFY(!incremental.isValid());
+
+    // Player changes, like a new rating, invalidate the standings
+    incremental.setStandings(t->numberOfRounds(), t->standings(t->state()));
+    QVERIFY(incremental.isValid());
+
+    const auto player = t->players().constFirst();
+    player->setRating(player->rating() + 100);
+    t->savePlayer(player);
+    QVERIFY(!incremental.isValid());
+
+    incremental.setStandings(t->numberOfRounds(), t->standings(t->state()));
+    QCOMPARE(t->changePlayerStartingRank(t->players().constLast(), 1), 1);
+    QVERIFY(!incremental.isValid());
+}
+
+void TiebreaksTest::testStateCutOff_data()
+{
+    QTest::addColumn<QString>("fileName");
+
+    QTest::newRow("tournament_1.txt") << u"tournament_1.txt"_s;
+    QTest::newRow("buchholz_1.trf") << u"buchholz_1.trf"_s;
+    QTest::newRow("buchholz_4.trf") << u"buchholz_4.trf"_s;
+}
+
+void TiebreaksTest::testStateCutOff()
+{
+    QFETCH(QString, fileName);
+
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1StringView(DATA_DIR) + "/"_L1 + fileName);
+    QVERIFY(tournament.has_value());
+
+    auto t = *tournament;
+
+    const auto compare = [t]() {
+        for (int round = 0; round <= t->numberOfRounds(); ++round) {
+            const auto view = t->state(round);
+            const State state{t, round};
+
+            QCOMPARE(view.lastRound(), round);
+            for (int i = 0; i < state.numberOfPlayers(); ++i) {
+                QCOMPARE(view.points(i), state.points(i));
+                QCOMPARE(view.pointsForTiebreaks(i), state.pointsForTiebreaks(i));
+                QCOMPARE(view.gamesWithWhite(i), state.gamesWithWhite(i));
+                QCOMPARE(view.gamesWithBlack(i), state.gamesWithBlack(i));
+            }
+        }
+    };
+
+    compare();
+    if (QTest::currentTestFailed()) {
+        return;
+    }
+
+    // The views follow the results
+    const auto before = t->state();
+    const auto pairing = t->pairings(1).constFirst();
+    const auto result = pairing->whiteResult() == Pairing::PartialResult::Win ? Pairing::Result{Pairing::PartialResult::Lost, Pairing::PartialResult::Win}
+                                                                                : Pairing::Result{Pairing::PartialResult::Win, Pairing::PartialResult::Lost};
+    QVERIFY(t->setResult(pairing, result));
+
+    compare();
+
+    // Earlier views are not modified
+    const auto white = State::index(pairing->whitePlayer());
+    QVERIFY(before.result(white, 0) != result.first);
+}
+
+void TiebreaksTest::testCompiledTiebreaks()
+{
+    Tiebreaks tiebreaks;
+    tiebreaks.addTiebreak(std::make_unique<Points>());
+    tiebreaks.addTiebreak(Tiebreaks::tiebreakFromTrf(u"BH/C1"_s).value());
+
+    const auto &compiled = tiebreaks.compiled();
+    QCOMPARE(compiled.size(), std::size_t{2});
+    QCOMPARE(compiled.at(1)->code(), u"BH/C1"_s);
+    QCOMPARE(tiebreaks.aggregates(), Tiebreak::Aggregates{Tiebreak::Aggregate::OpponentScores});
+
+    // The tiebreaks are only built again after a change
+    const auto first = compiled.at(0);
+    QCOMPARE(tiebreaks.compiled().at(0), first);
+
+    tiebreaks.addTiebreak(Tiebreaks::tiebreak(u"aob"_s));
+    QCOMPARE(tiebreaks.compiled().size(), std::size_t{3});
+    QVERIFY(tiebreaks.compiled().at(0) != first);
+    QVERIFY(tiebreaks.aggregates().testFlag(Tiebreak::Aggregate::Buchholz));
+
+    // A copy keeps its tiebreaks when they change, like the one used to compute the
+    // standings in another thread
+    const auto copy = tiebreaks.compiled();
+    tiebreaks.removeTiebreak(2);
+    QCOMPARE(tiebreaks.compiled().size(), std::size_t{2});
+    QCOMPARE(tiebreaks.aggregates(), Tiebreak::Aggregates{Tiebreak::Aggregate::OpponentScores});
+    QCOMPARE(copy.size(), std::size_t{3});
+    QVERIFY(Tiebreaks::aggregates(copy).testFlag(Tiebreak::Aggregate::Buchholz));
+
+    // Tiebreaks read from JSON are built right away
+    const auto json = Tiebreaks::fromJson(tiebreaks.toJson());
+    QCOMPARE(json.compiled().size(), std::size_t{2});
+    QCOMPARE(json.aggregates(), tiebreaks.aggregates());
+}
+
+void TiebreaksTest::testCalculateGroup()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1StringView(DATA_DIR) + "/tournament_1.txt"_L1);
+    QVERIFY(tournament.has_value());
+
+    auto t = *tournament;
+    const auto state = t->state();
+    const auto players = t->players();
+
+    for (const auto &code : {u"BH"_s, u"BH/C1"_s, u"AOB"_s}) {
+        auto tiebreak = Tiebreaks::tiebreakFromTrf(code).value();
+
+        const auto values = tiebreak->calculateGroup(t, state, players);
+        QCOMPARE(std::ssize(values), players.size());
+        for (int i = 0; i < players.size(); ++i) {
+            QCOMPARE(values.at(i), tiebreak->calculate(t, state, players, players.at(i)));
+        }
+    }
+}
+
+void TiebreaksTest::testStandingKey()
+{
+    QCOMPARE(Standing::quantize(0.), 0);
+    QCOMPARE(Standing::quantize(4.5), 450);
+    QCOMPARE(Standing::quantize(std::round(100 * 29. / 3) / 100.), 967);
+    QCOMPARE(Standing::quantize(-1.5), -150);
+
+    Player a(1, u"A"_s, 0);
+    Player b(2, u"B"_s, 0);
+
+    const Standing first(&a, {3.5, 10.});
+    const Standing second(&b, {3.5, 10.5});
+    const Standing third(&b, {3.5, 10.});
+
+    QCOMPARE(first.key(), (Standing::Key{350, 1000}));
+    QVERIFY(Standing::isBefore(second, first));
+    QVERIFY(!Standing::isBefore(first, second));
+
+    // Same values, so the starting rank decides
+    QCOMPARE(first.key(), third.key());
+    QVERIFY(Standing::isBefore(first, third));
+}
+
+void TiebreaksTest::testStandingsHistory()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1StringView(DATA_DIR) + "/tournament_1.txt"_L1);
+    QVERIFY(tournament.has_value());
+
+    auto t = *tournament;
+    QVERIFY(t->setTiebreaksFromTrf(u"pts,bh/c1,aob,win"_s));
+
+    const auto history = t->standingsHistory();
+    QCOMPARE(history.size(), t->numberOfRounds());
+
+    for (int round = 1; round <= t->numberOfRounds(); ++round) {
+        const auto expected = t->standings(State{t, round});
+        const auto &standings = history.at(round - 1);
+
+        QCOMPARE(standings.size(), expected.size());
+        for (qsizetype i = 0; i < standings.size(); ++i) {
+            QCOMPARE(standings.at(i).player(), expected.at(i).player());
+            QCOMPARE(standings.at(i).rank(), expected.at(i).rank());
+            QCOMPARE(standings.at(i).values(), expected.at(i).values());
+        }
+    }
+
+    // The Buchholz carried forward from the round before is the same as the computed one
+    const auto state = t->state();
+    auto previous = state.cutOff(0);
+    for (int round = 1; round <= state.lastRound(); ++round) {
+        const auto carried = state.cutOff(round);
+        const auto computed = state.cutOff(round);
+        carried.precompute(Tiebreak::Aggregate::Buchholz, previous);
+
+        for (int player = 0; player < state.numberOfPlayers(); ++player) {
+            QCOMPARE(carried.buchholz(player), computed.buchholz(player));
+        }
+
+        previous = carried;
+    }
+}
+
+void TiebreaksTest::testOpponentScores()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1StringView(DATA_DIR) + "/tournament_1.txt"_L1);
+    QVERIFY(tournament.has_value());
+
+    auto t = *tournament;
+    const auto state = t->state();
+    const auto players = t->players();
+    const auto last = state.lastRound() - 1;
+
+    auto bh = Tiebreaks::tiebreakFromTrf(u"BH"_s).value();
+    auto bhMedian = Tiebreaks::tiebreakFromTrf(u"BH/M1"_s).value();
+    auto sb = Tiebreaks::tiebreakFromTrf(u"SB"_s).value();
+    auto fb = Tiebreaks::tiebreakFromTrf(u"FB"_s).value();
+
+    QCOMPARE(bhMedian->code(), u"BH/M1"_s);
+    QCOMPARE(sb->code(), u"SB"_s);
+    QCOMPARE(fb->code(), u"FB"_s);
+
+    for (const auto player : players) {
+        const auto index = State::index(player);
+
+        // Only check the players who played all their games
+        bool played = true;
+        for (int round = 0; round < state.lastRound(); ++round) {
+            played &= state.hasPairing(index, round) && !Pairing::isUnplayed(state.result(index, round));
+        }
+        if (!played) {
+            continue;
+        }
+
+        double buchholz = 0.;
+        double sonnebornBerger = 0.;
+        double foreBuchholz = 0.;
+        double lowest = std::numeric_limits<double>::max();
+        double highest = std::numeric_limits<double>::lowest();
+
+        for (int round = 0; round < state.lastRound(); ++round) {
+            const auto opponent = state.opponent(index, round);
+            const auto score = state.pointsForTiebreaks(opponent);
+
+            buchholz += score;
+            sonnebornBerger += score * state.points(index, round);
+            lowest = std::min(lowest, score);
+            highest = std::max(highest, score);
+
+            // The game of the opponent in the last round counts as a draw
+            auto foreScore = score;
+            if (state.hasPairing(opponent, last) && !Pairing::isUnplayed(state.result(opponent, last))) {
+                foreScore += .5 - state.points(opponent, last);
+            }
+            foreBuchholz += foreScore;
+        }
+
+        QCOMPARE(bh->calculate(t, state, players, player), buchholz);
+        QCOMPARE(bhMedian->calculate(t, state, players, player), buchholz - lowest - highest);
+        QCOMPARE(sb->calculate(t, state, players, player), sonnebornBerger);
+        QCOMPARE(fb->calculate(t, state, players, player), foreBuchholz);
+    }
+}
+
+void TiebreaksTest::testPerformance()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1StringView(DATA_DIR) + "/tournament_1.txt"_L1);
+    QVERIFY(tournament.has_value());
+
+    auto t = *tournament;
+    const auto state = t->state();
+
+    for (int index = 0; index < state.numberOfPlayers(); ++index) {
+        QList<int> ratings;
+        double points = 0.;
+        for (int round = 0; round < state.lastRound(); ++round) {
+            if (state.hasPairing(index, round) && !Pairing::isUnplayed(state.result(index, round))) {
+                ratings << Performance::rating(state, state.opponent(index, round));
+                points += state.points(index, round);
+            }
+        }
+        if (ratings.isEmpty()) {
+            continue;
+        }
+
+        const auto aro = Performance::averageRatingOfOpponents(state, index);
+        const auto average = std::accumulate(ratings.cbegin(), ratings.cend(), 0.) / ratings.size();
+        QVERIFY(std::abs(aro - average) <= .5);
+
+        const auto percentage = static_cast<int>(std::lround(100 * points / ratings.size()));
+        QCOMPARE(Performance::tournamentPerformanceRating(state, index), aro + Performance::ratingDifference(percentage));
+
+        // The perfect performance is the lowest rating reaching the score
+        const auto expected = [&ratings](int rating) {
+            int total = 0;
+            for (const auto opponent : std::as_const(ratings)) {
+                total += Performance::expectedScore(rating - opponent);
+            }
+            return total;
+        };
+        const auto ptp = Performance::perfectTournamentPerformance(state, index);
+        const auto score = static_cast<int>(std::lround(100 * points));
+        if (points == 0.) {
+            QCOMPARE(ptp, *std::ranges::min_element(ratings) - 800);
+        } else if (points == ratings.size()) {
+            QCOMPARE(ptp, *std::ranges::max_element(ratings) + 800);
+        } else {
+            QVERIFY(expected(ptp) >= score);
+            QVERIFY(expected(ptp - 1) < score);
+        }
+    }
+
+    // Known answers, worked out with the tables 8.1.a and 8.1.b of the FIDE Rating
+    // Regulations
+    const auto players = t->players();
+    auto apro = Tiebreaks::tiebreakFromTrf(u"APRO"_s).value();
+
+    // Player 1 scored 8.5 against 1760, 1902, 1945, 2046, 2220, 2397, 2284, 2220
+    // and 2097 (the draw): 18871 / 9 = 2096.8 and, without 1760, 17111 / 8 = 2138.9.
+    // 94% gives a difference of 444. At 2642 the expected scores are 1.00, 1.00,
+    // 0.99, 0.98, 0.93, 0.80, 0.90, 0.93 and 0.97, which add up to 8.50; at 2641
+    // the difference of 357 against 2284 only gives 0.89.
+    // The performances of the opponents are 1962, 1999, 2164, 2001, 2085, 2372,
+    // 2263, 2212 and 2140, 19198 / 9 = 2133.1.
+    const auto first = State::index(players.at(0));
+    QCOMPARE(Performance::averageRatingOfOpponents(state, first), 2097);
+    QCOMPARE(Performance::averageRatingOfOpponents(state, first, 1), 2139);
+    QCOMPARE(Performance::tournamentPerformanceRating(state, first), 2541);
+    QCOMPARE(Performance::perfectTournamentPerformance(state, first), 2642);
+    QCOMPARE(apro->calculate(t, state, players, players.at(0)), 2133.);
+
+    // Player 17 scored 3 out of 6 against 1647, 1835, 1709, 1843, 1737 and 1860
+    // before withdrawing: 10631 / 6 = 1771.8 and, without 1647, 8984 / 5 = 1796.8.
+    // 50% gives a difference of 0. At 1771 the expected scores are 0.67, 0.41, 0.59,
+    // 0.40, 0.55 and 0.38, which add up to 3.00; at 1770 the difference of 61
+    // against 1709 only gives 0.58.
+    // The performances of the opponents are 1801, 1891, 1618, 2026, 1728 and 1912,
+    // 10976 / 6 = 1829.3.
+    const auto withdrawn = State::index(players.at(16));
+    QCOMPARE(Performance::averageRatingOfOpponents(state, withdrawn), 1772);
+    QCOMPARE(Performance::averageRatingOfOpponents(state, withdrawn, 1), 1797);
+    QCOMPARE(Performance::tournamentPerformanceRating(state, withdrawn), 1772);
+    QCOMPARE(Performance::perfectTournamentPerformance(state, withdrawn), 1771);
+    QCOMPARE(apro->calculate(t, state, players, players.at(16)), 1829.);
+
+    // Player 86 lost every game, against 1809, 1573, 1688, 1526, 1389, 1660, 1328
+    // and an unrated player counted as 1400: 12373 / 8 = 1546.6. 0% gives a
+    // difference of -800, and the perfect performance is the lowest rating minus
+    // 800. The performances of the opponents are 1729, 1659, 1727, 1681, 1551,
+    // 1229, 1430 and 1256, 12262 / 8 = 1532.8.
+    const auto lost = State::index(players.at(85));
+    QCOMPARE(Performance::averageRatingOfOpponents(state, lost), 1547);
+    QCOMPARE(Performance::averageRatingOfOpponents(state, lost, 1), 1578);
+    QCOMPARE(Performance::tournamentPerformanceRating(state, lost), 747);
+    QCOMPARE(Performance::perfectTournamentPerformance(state, lost), 528);
+    QCOMPARE(apro->calculate(t, state, players, players.at(85)), 1533.);
+
+    // After three rounds player 1 had won against 1760, 1902 and 1945: the perfect
+    // performance is the highest rating plus 800
+    QCOMPARE(Performance::perfectTournamentPerformance(t->state(3), first), 2745);
+}
+
+void TiebreaksTest::testDirectEncounter()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1StringView(DATA_DIR) + "/tournament_1.txt"_L1);
+    QVERIFY(tournament.has_value());
+
+    auto t = *tournament;
+    auto tiebreak = Tiebreaks::tiebreakFromTrf(u"DE"_s).value();
+    QCOMPARE(tiebreak->code(), u"DE"_s);
+
+    // Players of every game of the first round
+    const auto state = t->state(1);
+    for (const auto pairing : t->pairings(1)) {
+        if (pairing->blackPlayer() == nullptr || Pairing::isUnplayed(pairing->whiteResult())) {
+            continue;
+        }
+
+        const QList<Player *> players{pairing->whitePlayer(), pairing->blackPlayer()};
+        const auto values = tiebreak->calculateGroup(t, state, players);
+        const auto points = Pairing::pointsForResult(pairing->whiteResult());
+
+        if (points == 1.) {
+            QVERIFY(values.at(0) > values.at(1));
+        } else if (points == 0.) {
+            QVERIFY(values.at(0) < values.at(1));
+        } else {
+            QCOMPARE(values.at(0), values.at(1));
+        }
+        QCOMPARE(tiebreak->calculate(t, state, players, players.at(1)), values.at(1));
+    }
+
+    // Players who didn't meet are not separated
+    const auto pairings = t->pairings(1);
+    const QList<Player *> players{pairings.at(0)->whitePlayer(), pairings.at(1)->whitePlayer()};
+    const auto values = tiebreak->calculateGroup(t, state, players);
+    QCOMPARE(values.at(0), values.at(1));
+
+    // Players 1-4 met each other: 1 and 2 scored 2 points among them, 3 and 4
+    // scored 1. 1 beat 2 and 4 beat 3, so the sub-ties are broken by their game.
+    // 5 beat 6, 7 and 8, 6 drew 7, and 8 only met 5.
+    auto encounters = event->importTournament(QLatin1StringView(DATA_DIR) + "/directencounter_1.trf"_L1);
+    QVERIFY(encounters.has_value());
+
+    const auto groupValues = [](Tournament *tournament, Tiebreak *tiebreak, const QList<int> &startingRanks) {
+        const auto players = tournament->players();
+        QList<Player *> group;
+        for (const auto startingRank : startingRanks) {
+            group << players.at(startingRank - 1);
+        }
+        return tiebreak->calculateGroup(tournament, tournament->state(), group);
+    };
+
+    QCOMPARE(groupValues(*encounters, tiebreak.get(), {3, 1, 4, 2}), (std::vector<double>{1., 4., 2., 3.}));
+
+    // 1 beat 4, 3 beat 1 and 4 beat 3: nobody is ahead
+    QCOMPARE(groupValues(*encounters, tiebreak.get(), {1, 3, 4}), (std::vector<double>{3., 3., 3.}));
+
+    // Nobody can catch 5, the others can still catch each other
+    QCOMPARE(groupValues(*encounters, tiebreak.get(), {8, 5, 7, 6}), (std::vector<double>{3., 4., 3., 3.}));
+    QCOMPARE(groupValues(*encounters, tiebreak.get(), {5, 6, 8}), (std::vector<double>{3., 2., 2.}));
+
+    // Round-robin of 66 players where the lower starting rank always wins, except
+    // 64, 65 and 66, who drew among them
+    auto large = event->importTournament(QLatin1StringView(DATA_DIR) + "/directencounter_2.trf"_L1);
+    QVERIFY(large.has_value());
+
+    QList<int> startingRanks;
+    std::vector<double> expected;
+    for (int startingRank = 66; startingRank >= 1; --startingRank) {
+        startingRanks << startingRank;
+        expected.push_back(startingRank <= 63 ? 67. - startingRank : 3.);
+    }
+    QCOMPARE(groupValues(*large, tiebreak.get(), startingRanks), expected);
+}
+
+void TiebreaksTest::testProgressiveTiebreaks()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1StringView(DATA_DIR) + "/buchholz_4.trf"_L1);
+    QVERIFY(tournament.has_value());
+
+    auto t = *tournament;
+
+    auto ps = Tiebreaks::tiebreakFromTrf(u"PS"_s).value();
+    auto psCut = Tiebreaks::tiebreakFromTrf(u"PS/C1"_s).value();
+    auto ks = Tiebreaks::tiebreakFromTrf(u"KS"_s).value();
+    auto rep = Tiebreaks::tiebreakFromTrf(u"REP"_s).value();
+
+    QCOMPARE(psCut->code(), u"PS/C1"_s);
+
+    const auto check = [&](Tournament *source, int startingRank, double progressive, double progressiveCut, double koya, double rounds) {
+        const auto state = source->state();
+        const auto players = source->players();
+        const auto player = players.at(startingRank - 1);
+
+        QCOMPARE(ps->calculate(source, state, players, player), progressive);
+        QCOMPARE(psCut->calculate(source, state, players, player), progressiveCut);
+        QCOMPARE(ks->calculate(source, state, players, player), koya);
+        QCOMPARE(rep->calculate(source, state, players, player), rounds);
+    };
+
+    // Player 1 got a pairing-allocated bye, was absent twice and won the last round
+    // by forfeit: 1 + 1 + 1 + 2 points, and two rounds elected to play.
+    // Player 2 was absent twice, won against 3 and lost the last round by forfeit:
+    // 0 + 1 + 1 + 1 points, and only the game played. That game is the only one
+    // for the Koya system, and neither 2 nor 3 reached 2 points.
+    check(t, 1, 5., 4., 0., 2.);
+    check(t, 2, 3., 3., 0., 1.);
+    check(t, 3, 0., 0., 0., 1.);
+
+    // Players 2 and 3 scored exactly 2 points out of 4 over the board, which is
+    // enough for the Koya system. Player 4 won by forfeit in round 2 and took a
+    // half-point bye in round 4; player 6 lost by forfeit in round 2.
+    auto progressive = event->importTournament(QLatin1StringView(DATA_DIR) + "/progressive_1.trf"_L1);
+    QVERIFY(progressive.has_value());
+
+    // 1 beat 2 and 3 and lost to 5 (2.5 points): 1 + 2 + 2 + 3 points
+    check(*progressive, 1, 8., 7., 2., 4.);
+
+    // 3 drew 4 (2.5 points) and 2, lost to 1 and beat 6 (0 points):
+    // .5 + .5 + 1.5 + 2 points
+    check(*progressive, 3, 4.5, 4., 1., 4.);
+
+    // 4 drew 3 and 2, the forfeit and the bye don't count for the Koya system:
+    // .5 + 1.5 + 2 + 2.5 points, and three rounds elected to play
+    check(*progressive, 4, 6.5, 6., 1., 3.);
+
+    check(*progressive, 6, 0., 0., 0., 3.);
+}
+
 QTEST_GUILESS_MAIN(TiebreaksTest)
 
 #include "tiebreakstest.moc"
@@ -1,12 +1,25 @@
 // SPDX-FileCopyrightText: 2024 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <QCoroTask>
 #include <QObject>
+#include <QFileInfo>
+#include <QSet>
+#include <QSignalSpy>
+#include <QSqlDatabase>
 #include <QString>
+#include <QTemporaryDir>
 #include <QTemporaryFile>
 #include <QTest>
 
+#include <algorithm>
+
+#include "db.h"
 #include "event.h"
+#include "forecast.h"
+#include "generator.h"
+#include "pairings/pairingcache.h"
+#include "statementcache.h"
 #include "timecontrol.h"
 
 using namespace Qt::Literals::StringLiterals;
@@ -24,10 +37,15 @@ private Q_SLOTS:
     void testImportTrf();
     void testLoadTournament();
     void testSortPlayers();
+    void testSavePlayers();
+    void testStatementCache();
+    void testDurability();
     void testRemovePairings_data();
     void testRemovePairings();
     void testTimeControl_data();
     void testTimeControl();
+    void testGenerator();
+    void testForecast();
 };
 
 void TournamentTest::testNewTournament()
@@ -180,6 +198,174 @@ void TournamentTest::testSortPlayers()
     QCOMPARE(players[7]->name(), "Player B"_L1);
 }
 
+void TournamentTest::testSavePlayers()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1String(DATA_DIR) + u"/tournament_2.trf"_s);
+    QVERIFY(tournament.has_value());
+
+    QSignalSpy spy(*tournament, &Tournament::numberOfRatedPlayersChanged);
+
+    // All the starting ranks are saved at once
+    (*tournament)->sortPlayers();
+    QCOMPARE(spy.count(), 1);
+
+    const auto player = (*tournament)->players().constLast();
+    QCOMPARE((*tournament)->changePlayerStartingRank(player, 2), 2);
+    QCOMPARE(spy.count(), 2);
+
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    QVERIFY(event->saveAs(file.fileName()));
+
+    event = std::make_unique<Event>();
+    QVERIFY(event->open(file.fileName()).has_value());
+
+    const auto players = event->tournament(0)->players();
+
+    QCOMPARE(players.size(), 8);
+    QCOMPARE(players[0]->name(), "Player 3"_L1);
+    QCOMPARE(players[1]->name(), "Player B"_L1);
+    QCOMPARE(players[2]->name(), "Player 2"_L1);
+    QCOMPARE(players[7]->name(), "Player A"_L1);
+
+    for (int i = 0; i < players.size(); ++i) {
+        QCOMPARE(players[i]->startingRank(), i + 1);
+    }
+}
+
+void TournamentTest::testStatementCache()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1String(DATA_DIR) + u"/tournament_2.trf"_s);
+    QVERIFY(tournament.has_value());
+
+    const auto statistics = event->statementStatistics();
+    QVERIFY(!statistics.isEmpty());
+
+    // Every player is added with the same prepared statement
+    const auto addPlayer = std::ranges::find(statistics, ADD_PLAYER_QUERY, &StatementCache::Statistics::sql);
+    QVERIFY(addPlayer != statistics.cend());
+    QCOMPARE(addPlayer->executions, qint64{(*tournament)->numberOfPlayers()});
+
+    for (qsizetype i = 1; i < statistics.size(); ++i) {
+        QVERIFY(statistics.at(i - 1).elapsed >= statistics.at(i).elapsed);
+    }
+
+    // The pairing cache uses the statements of the event too
+    {
+        PairingCache cache(event->statements(), (*tournament)->id());
+        const auto key = QByteArray(32, 'k');
+        QVERIFY(cache.insert(key, 1, {{1, 2}, {3, 4}}).has_value());
+
+        const auto pairings = cache.find(key);
+        QVERIFY(pairings.has_value());
+        QVERIFY(pairings->has_value());
+        QCOMPARE(pairings->value(), (PairingCache::Pairings{{1, 2}, {3, 4}}));
+        QVERIFY(cache.find(key).has_value());
+        QVERIFY(cache.clear().has_value());
+
+        const auto statistics = event->statementStatistics();
+        const auto executions = [&statistics](const QString &sql) {
+            const auto it = std::ranges::find(statistics, sql, &StatementCache::Statistics::sql);
+            return it == statistics.cend() ? qint64{0} : it->executions;
+        };
+        QCOMPARE(executions(ADD_CACHED_PAIRINGS_QUERY), qint64{1});
+        QCOMPARE(executions(PRUNE_CACHED_PAIRINGS_QUERY), qint64{1});
+        QCOMPARE(executions(GET_CACHED_PAIRINGS_QUERY), qint64{2});
+        QCOMPARE(executions(TOUCH_CACHED_PAIRINGS_QUERY), qint64{2});
+        QCOMPARE(executions(CLEAR_CACHED_PAIRINGS_QUERY), qint64{1});
+    }
+
+    {
+        auto db = QSqlDatabase::addDatabase(u"QSQLITE"_s, u"statementcachetest"_s);
+        db.setDatabaseName(u":memory:"_s);
+        QVERIFY(db.open());
+
+        StatementCache cache(db);
+        const auto sql = u"SELECT 1 UNION SELECT 2;"_s;
+
+        {
+            auto first = cache.statement(sql);
+            QVERIFY(first.has_value());
+            QVERIFY(first->exec());
+            QVERIFY(first->query().next());
+            QCOMPARE(first->query().value(0).toInt(), 1);
+
+            // The first statement is still being read, so this one gets its own query
+            auto second = cache.statement(sql);
+            QVERIFY(second.has_value());
+            QVERIFY(second->exec());
+            QVERIFY(second->query().next());
+            QCOMPARE(second->query().value(0).toInt(), 1);
+
+            QVERIFY(first->query().next());
+            QCOMPARE(first->query().value(0).toInt(), 2);
+        }
+
+        // Both executions are counted for the same statement
+        QCOMPARE(cache.statistics().size(), 1);
+        QCOMPARE(cache.statistics().constFirst().executions, qint64{2});
+
+        QVERIFY(!cache.statement(u"SELECT FROM;"_s).has_value());
+        QCOMPARE(cache.statistics().size(), 1);
+    }
+
+    QSqlDatabase::database(u"statementcachetest"_s, false).close();
+    QSqlDatabase::removeDatabase(u"statementcachetest"_s);
+}
+
+void TournamentTest::testDurability()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const auto fileName = dir.filePath(u"event.chessament"_s);
+    const auto logFileName = fileName + u"-wal"_s;
+
+    auto event = std::make_unique<Event>();
+    QCOMPARE(event->durability(), Event::Durability::WriteAheadLog);
+    QVERIFY(event->create(fileName).has_value());
+
+    auto tournament = event->createTournament();
+    QVERIFY(tournament.has_value());
+    (*tournament)->setName(u"Test tournament"_s);
+
+    // The changes are in the log until it is copied to the file
+    QVERIFY(QFileInfo(logFileName).size() > 0);
+
+    QVERIFY(event->checkpoint().has_value());
+    QCOMPARE(QFileInfo(logFileName).size(), 0);
+
+    (*tournament)->setCity(u"Place"_s);
+    QVERIFY(QFileInfo(logFileName).size() > 0);
+
+    QTemporaryFile copy;
+    QVERIFY(copy.open());
+    QVERIFY(event->saveAs(copy.fileName()).has_value());
+    QCOMPARE(QFileInfo(logFileName).size(), 0);
+
+    event.reset();
+    QVERIFY(!QFileInfo::exists(logFileName));
+
+    // Open the file again with a rollback journal
+    event = std::make_unique<Event>();
+    event->setDurability(Event::Durability::Full);
+    event->setSecureDelete(false);
+    QVERIFY(event->open(fileName).has_value());
+
+    QCOMPARE(event->tournament(0)->name(), u"Test tournament"_s);
+    QCOMPARE(event->tournament(0)->city(), u"Place"_s);
+
+    event->tournament(0)->setName(u"Other name"_s);
+    QVERIFY(!QFileInfo::exists(logFileName));
+    QVERIFY(event->checkpoint().has_value());
+}
+
 void TournamentTest::testRemovePairings_data()
 {
     QTest::addColumn<bool>("keepByes");
@@ -230,5 +416,93 @@ void TournamentTest::testTimeControl()
     QVERIFY(timeControl == TimeControl::fromTrf(value));
 }
 
+void TournamentTest::testGenerator()
+{
+    TournamentGenerator::Options options;
+    options.players = 31;
+    options.rounds = 5;
+    options.byeProbability = 0.05;
+    options.forfeitProbability = 0.05;
+    options.seed = 42;
+
+    QString trf;
+
+    for (int i = 0; i < 2; ++i) {
+        auto event = std::make_unique<Event>();
+        QVERIFY(event->create());
+
+        auto t = event->createTournament();
+        QVERIFY(t.has_value());
+
+        TournamentGenerator generator{options};
+        const auto ok = QCoro::waitFor(generator.generate(*t));
+        QVERIFY2(ok.has_value(), qPrintable(ok.error()));
+
+        QCOMPARE((*t)->numberOfPlayers(), options.players);
+        QCOMPARE((*t)->currentRound(), options.rounds);
+
+        for (int round = 1; round <= options.rounds; ++round) {
+            QSet<Player *> players;
+            for (const auto &pairing : (*t)->pairings(round)) {
+                QVERIFY(!players.contains(pairing->whitePlayer()));
+                players.insert(pairing->whitePlayer());
+                if (pairing->blackPlayer() != nullptr) {
+                    QVERIFY(!players.contains(pairing->blackPlayer()));
+                    players.insert(pairing->blackPlayer());
+                }
+            }
+            QCOMPARE(players.size(), options.players);
+            QVERIFY((*t)->isRoundFinished(round));
+        }
+
+        // The same seed generates the same tournament
+        const auto current = (*t)->toTrf();
+        if (i == 0) {
+            trf = current;
+        } else {
+            QCOMPARE(current, trf);
+        }
+    }
+}
+
+void TournamentTest::testForecast()
+{
+    auto event = std::make_unique<Event>();
+    QVERIFY(event->create());
+
+    auto tournament = event->importTournament(QLatin1String(DATA_DIR) + u"/tournament_1.txt"_s);
+    QVERIFY(tournament.has_value());
+
+    auto t = *tournament;
+    t->setNumberOfRounds(11);
+
+    Forecast forecast;
+    QSignalSpy finished(&forecast, &Forecast::finished);
+
+    forecast.start(t, 200);
+    QVERIFY(finished.wait(60000));
+
+    QCOMPARE(forecast.completedSimulations(), 200);
+    QVERIFY(!forecast.isRunning());
+
+    const auto results = forecast.results();
+    QCOMPARE(results.size(), t->numberOfPlayers());
+
+    double winners = 0.;
+    for (const auto &result : results) {
+        QCOMPARE(result.probabilities.size(), forecast.bands().size());
+        for (int band = 0; band < result.probabilities.size(); ++band) {
+            QVERIFY(result.probabilities[band] >= 0. && result.probabilities[band] <= 1.);
+            if (band > 0) {
+                QVERIFY(result.probabilities[band] >= result.probabilities[band - 1]);
+            }
+        }
+        winners += result.probabilities[0];
+    }
+
+    // Tied players share the first place
+    QVERIFY(winners >= 1.);
+}
+
 QTEST_GUILESS_MAIN(TournamentTest)
 #include "tournamenttest.moc"
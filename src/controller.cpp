@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "controller.h"
+#include "chessamentconfig.h"
 #include "standing.h"
 #include "tournament/pairing.h"
 #include "tournament/state.h"
@@ -20,11 +21,26 @@
 
 using namespace Qt::Literals::StringLiterals;
 
+namespace
+{
+// Returns a new event using the storage settings
+std::unique_ptr<Event> createEvent()
+{
+    auto event = std::make_unique<Event>();
+    event->setDurability(Config::writeAheadLog() ? Event::Durability::WriteAheadLog : Event::Durability::Full);
+    event->setSecureDelete(Config::secureDelete());
+
+    return event;
+}
+}
+
 Controller::Controller(QObject *parent)
     : QObject(parent)
     , m_playersModel(new PlayersModel(this))
     , m_pairingModel(new PairingModel(this))
     , m_standingsModel(new StandingsModel(this))
+    , m_incrementalStandings(new IncrementalStandings(this))
+    , m_forecastModel(new ForecastModel(this))
 #ifdef BUILD_EXPERIMENTAL
     , m_accountManager(std::make_unique<AccountManager>())
 #endif
@@ -32,13 +48,26 @@ Controller::Controller(QObject *parent)
     connect(m_playersModel, &PlayersModel::playerChanged, this, [this](Player *player, PlayersModel::Columns field) {
         Q_UNUSED(field);
         m_tournament->savePlayer(player);
+
+        // The rating or the starting rank of the player may have changed
+        setAreStandingsValid(false);
     });
 
     connect(m_pairingModel, &PairingModel::pairingChanged, this, [this]() {
-        setAreStandingsValid(false);
+        // Results already updated the incremental standings
+        if (!m_incrementalStandings->isValid()) {
+            setAreStandingsValid(false);
+        }
         Q_EMIT hasCurrentRoundFinishedChanged();
     });
 
+    connect(m_incrementalStandings, &IncrementalStandings::standingsChanged, this, [this]() {
+        m_standingsModel->setStandings(m_incrementalStandings->standings());
+    });
+    connect(m_incrementalStandings, &IncrementalStandings::invalidated, this, [this]() {
+        setAreStandingsValid(false);
+    });
+
 #ifdef BUILD_EXPERIMENTAL
     connect(m_accountManager.get(), &AccountManager::openUrl, this, [](const QUrl &url) {
         QDesktopServices::openUrl(url);
@@ -86,6 +115,13 @@ void Controller::setTournament(Tournament *tournament)
     m_pairingModel->setTournament(m_tournament);
     m_pairingModel->setPairings(m_tournament->pairings(1));
     m_standingsModel->setTournament(m_tournament);
+    m_incrementalStandings->setTournament(m_tournament);
+    m_forecastModel->setTournament(m_tournament);
+
+    // Starting ranks and ratings change when players are sorted, deleted or updated
+    connect(m_tournament, &Tournament::numberOfRatedPlayersChanged, this, [this]() {
+        setAreStandingsValid(false);
+    });
 
     setHasOpenTournament(true);
     setCurrentRound(1);
@@ -153,6 +189,10 @@ QString Controller::resultToString(Pairing::PartialResult whiteResult, Pairing::
 
 void Controller::setAreStandingsValid(bool valid)
 {
+    if (!valid) {
+        m_incrementalStandings->invalidate();
+    }
+
     if (m_areStandingsValid == valid) {
         return;
     }
@@ -162,7 +202,7 @@ void Controller::setAreStandingsValid(bool valid)
 
 void Controller::importTrf(const QUrl &fileUrl)
 {
-    auto event = std::make_unique<Event>();
+    auto event = createEvent();
 
     if (auto ok = event->create(); !ok) {
         setError(ok.error());
@@ -250,12 +290,16 @@ QCoro::QmlTask Controller::reloadStandings(int maxRound)
 
 QCoro::Task<> Controller::updateStandings(int maxRound)
 {
-    const auto standings = co_await QtConcurrent::run([this, maxRound]() -> QList<Standing> {
+    // The job works on a copy, the tiebreaks can be edited while it runs
+    auto tiebreaks = m_tournament->tiebreaks().compiled();
+
+    const auto standings = co_await QtConcurrent::run([this, maxRound, tiebreaks = std::move(tiebreaks)]() -> QList<Standing> {
         const State state = m_tournament->state(maxRound);
-        return m_tournament->standings(state);
+        return m_tournament->standings(state, tiebreaks);
     });
 
     m_standingsModel->setStandings(standings);
+    m_incrementalStandings->setStandings(maxRound, standings);
 
     setAreStandingsValid(true);
 }
@@ -269,7 +313,7 @@ void Controller::sortPlayers()
 void Controller::newTournament(const QUrl &fileUrl, const QString &name, int numberOfRounds)
 {
     auto fileName = Utils::maybeAddExtension(fileUrl, u".chessament"_s);
-    auto event = std::make_unique<Event>();
+    auto event = createEvent();
 
     if (const auto ok = event->create(fileName.toLocalFile()); !ok) {
         setError(ok.error());
@@ -292,7 +336,7 @@ void Controller::newTournament(const QUrl &fileUrl, const QString &name, int num
 
 void Controller::openEvent(const QUrl &fileUrl)
 {
-    auto event = std::make_unique<Event>();
+    auto event = createEvent();
 
     if (const auto ok = event->open(fileUrl.toLocalFile()); !ok) {
         setError(ok.error());
@@ -331,6 +375,11 @@ StandingsModel *Controller::standingsModel() const
     return m_standingsModel;
 }
 
+ForecastModel *Controller::forecastModel() const
+{
+    return m_forecastModel;
+}
+
 #ifdef BUILD_EXPERIMENTAL
 AccountManager *Controller::accountManager() const
 {
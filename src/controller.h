@@ -7,10 +7,12 @@
 #include <QObject>
 #include <QTemporaryFile>
 
+#include "forecastmodel.h"
 #include "pairingmodel.h"
 #include "playersmodel.h"
 #include "standingsmodel.h"
 #include "tournament/event.h"
+#include "tournament/incrementalstandings.h"
 #include "tournament/tournament.h"
 
 #ifdef BUILD_EXPERIMENTAL
@@ -35,6 +37,7 @@ class Controller : public QObject
     Q_PROPERTY(PlayersModel *playersModel READ playersModel CONSTANT)
     Q_PROPERTY(PairingModel *pairingModel READ pairingModel CONSTANT)
     Q_PROPERTY(StandingsModel *standingsModel READ standingsModel CONSTANT)
+    Q_PROPERTY(ForecastModel *forecastModel READ forecastModel CONSTANT)
 
     Q_PROPERTY(bool experimental READ experimental CONSTANT)
 
@@ -51,6 +54,7 @@ public:
         Players,
         Pairings,
         Standings,
+        Forecast,
     };
     Q_ENUM(View);
 
@@ -87,10 +91,14 @@ public:
     std::unique_ptr<Document> standingsDocument(int round);
     Q_INVOKABLE void saveStandingsDocument(const QUrl &fileUrl, int round);
     Q_INVOKABLE void printStandingsDocument(int round);
+    QCoro::Task<std::unique_ptr<Document>> standingsHistoryDocument();
+    Q_INVOKABLE QCoro::QmlTask saveStandingsHistoryDocument(const QUrl &fileUrl);
+    Q_INVOKABLE QCoro::QmlTask printStandingsHistoryDocument();
 
     [[nodiscard]] PlayersModel *playersModel() const;
     [[nodiscard]] PairingModel *pairingModel() const;
     [[nodiscard]] StandingsModel *standingsModel() const;
+    [[nodiscard]] ForecastModel *forecastModel() const;
 
     [[nodiscard]] constexpr static bool experimental();
 
@@ -127,6 +135,9 @@ private:
 
     QCoro::Task<> makePairings(bool sort, uint color);
 
+    QCoro::Task<> writeStandingsHistoryDocument(QUrl fileUrl);
+    QCoro::Task<> printStandingsHistory();
+
     std::unique_ptr<Event> m_event;
     Tournament *m_tournament;
 
@@ -138,6 +149,8 @@ private:
     PlayersModel *m_playersModel;
     PairingModel *m_pairingModel;
     StandingsModel *m_standingsModel;
+    IncrementalStandings *m_incrementalStandings;
+    ForecastModel *m_forecastModel;
 
 #ifdef BUILD_EXPERIMENTAL
     std::unique_ptr<AccountManager> m_accountManager;
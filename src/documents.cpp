@@ -11,7 +11,26 @@
 #include <KIO/OpenUrlJob>
 #include <KLocalizedString>
 
+#include <QCoroFuture>
 #include <QTextDocument>
+#include <QtConcurrentRun>
+
+namespace
+{
+QString standingsTitle(Tournament *tournament, int round)
+{
+    if (round < tournament->numberOfRounds()) {
+        if (tournament->isRoundFinished(round)) {
+            return i18nc("@title", "Standings After Round %1", round);
+        }
+        return i18nc("@title", "Provisional Standings After Round %1", round);
+    }
+    if (tournament->isRoundFinished(round)) {
+        return i18nc("@title", "Final Standings");
+    }
+    return i18nc("@title", "Provisional Final Standings", round);
+}
+}
 
 std::unique_ptr<Document> Controller::playersDocument()
 {
@@ -96,22 +115,7 @@ std::unique_ptr<Document> Controller::standingsDocument(int round)
     auto doc = std::make_unique<Document>();
 
     doc->addTitle(1, m_tournament->name());
-
-    QString title;
-    if (round < m_tournament->numberOfRounds()) {
-        if (m_tournament->isRoundFinished(round)) {
-            title = i18nc("@title", "Standings After Round %1", round);
-        } else {
-            title = i18nc("@title", "Provisional Standings After Round %1", round);
-        }
-    } else {
-        if (m_tournament->isRoundFinished(round)) {
-            title = i18nc("@title", "Final Standings");
-        } else {
-            title = i18nc("@title", "Provisional Final Standings", round);
-        }
-    }
-    doc->addTitle(2, title);
+    doc->addTitle(2, standingsTitle(m_tournament, round));
 
     const State state = m_tournament->state(round);
 
@@ -141,3 +145,58 @@ void Controller::printStandingsDocument(int round)
     const auto doc = standingsDocument(round);
     doc->print();
 }
+
+QCoro::Task<std::unique_ptr<Document>> Controller::standingsHistoryDocument()
+{
+    // The job works on a copy, the tiebreaks can be edited while it runs
+    auto tiebreaks = m_tournament->tiebreaks().compiled();
+    const auto maxRound = std::max(1, m_tournament->currentRound());
+
+    const auto history = co_await QtConcurrent::run([this, maxRound, tiebreaks = std::move(tiebreaks)]() -> QList<QList<Standing>> {
+        return m_tournament->standingsHistory(maxRound, tiebreaks);
+    });
+
+    auto doc = std::make_unique<Document>();
+
+    doc->addTitle(1, m_tournament->name());
+
+    for (int round = 1; round <= history.size(); ++round) {
+        doc->addTitle(2, standingsTitle(m_tournament, round));
+
+        StandingsModel model;
+        model.setTournament(m_tournament);
+        model.setStandings(history.at(round - 1));
+        doc->addTable(model);
+    }
+
+    co_return doc;
+}
+
+QCoro::QmlTask Controller::saveStandingsHistoryDocument(const QUrl &fileUrl)
+{
+    return writeStandingsHistoryDocument(fileUrl);
+}
+
+QCoro::Task<> Controller::writeStandingsHistoryDocument(QUrl fileUrl)
+{
+    auto fileName = Utils::maybeAddExtension(fileUrl, u".pdf"_s);
+
+    const auto doc = co_await standingsHistoryDocument();
+    doc->saveAs(fileName.toLocalFile());
+
+    if (Config::openExportedPdfFiles()) {
+        auto *job = new KIO::OpenUrlJob(fileName);
+        job->start();
+    }
+}
+
+QCoro::QmlTask Controller::printStandingsHistoryDocument()
+{
+    return printStandingsHistory();
+}
+
+QCoro::Task<> Controller::printStandingsHistory()
+{
+    const auto doc = co_await standingsHistoryDocument();
+    doc->print();
+}
@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "forecastmodel.h"
+
+#include <KLocalizedString>
+#include <QLocale>
+
+#include "tournament/pairings/pairingsnapshot.h"
+#include "tournament/player.h"
+#include "tournament/tournament.h"
+
+ForecastModel::ForecastModel(QObject *parent)
+    : QAbstractTableModel(parent)
+    , m_forecast(new Forecast(this))
+{
+    connect(m_forecast, &Forecast::progress, this, &ForecastModel::updateResults);
+    connect(m_forecast, &Forecast::finished, this, [this]() {
+        updateResults();
+        Q_EMIT runningChanged();
+    });
+}
+
+int ForecastModel::rowCount(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent);
+
+    return static_cast<int>(m_results.size());
+}
+
+int ForecastModel::columnCount(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent);
+
+    return ExpectedPoints + 1 + static_cast<int>(m_forecast->bands().size());
+}
+
+QVariant ForecastModel::data(const QModelIndex &index, int role) const
+{
+    Q_ASSERT(checkIndex(index, CheckIndexOption::IndexIsValid | CheckIndexOption::ParentIsInvalid));
+
+    const auto player = m_players.at(index.row());
+    const auto &result = m_results.at(index.row());
+
+    if (role == Qt::DisplayRole || role == SortRole) {
+        const bool display = role == Qt::DisplayRole;
+
+        switch (index.column()) {
+        case StartingRank:
+            return player->startingRank();
+        case Title:
+            return display ? QVariant(player->title()) : QVariant(Player::titleStrengthLevel(player->title()));
+        case Name:
+            return player->name();
+        case Rating:
+            return player->rating();
+        case Points:
+            return display ? QVariant(QLocale().toString(m_points.at(index.row()))) : QVariant(m_points.at(index.row()));
+        case ExpectedPoints:
+            return display ? QVariant(QLocale().toString(result.expectedPoints, 'f', 2)) : QVariant(result.expectedPoints);
+        default: {
+            const auto probability = result.probabilities.at(index.column() - ExpectedPoints - 1);
+            return display ? QVariant(QLocale().toString(probability * 100., 'f', 1) + u" %"_s) : QVariant(probability);
+        }
+        }
+    } else if (role == Qt::TextAlignmentRole) {
+        switch (index.column()) {
+        case Name:
+            return Qt::AlignLeading;
+        case Title:
+            return Qt::AlignCenter;
+        default:
+            return Qt::AlignTrailing;
+        }
+    }
+
+    return {};
+}
+
+QVariant ForecastModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    Q_UNUSED(orientation)
+
+    if (role == Qt::DisplayRole) {
+        switch (section) {
+        case StartingRank:
+            return i18nc("@title:column Player Starting Rank Number", "№");
+        case Title:
+            return i18nc("@title:column Player Title", "Title");
+        case Name:
+            return i18nc("@title:column Player Name", "Name");
+        case Rating:
+            return i18nc("@title:column", "Rating");
+        case Points:
+            return i18nc("@title:column Current points", "Pts.");
+        case ExpectedPoints:
+            return i18nc("@title:column Expected final points", "Exp. Pts.");
+        default: {
+            const auto band = m_forecast->bands().at(section - ExpectedPoints - 1);
+            if (band == 1) {
+                return i18nc("@title:column Probability of winning the tournament", "1st");
+            }
+            return i18nc("@title:column Probability of finishing in the first %1 places", "Top %1", band);
+        }
+        }
+    }
+    if (role == EnableSort) {
+        return true;
+    }
+
+    return {};
+}
+
+QHash<int, QByteArray> ForecastModel::roleNames() const
+{
+    return {
+        {Qt::DisplayRole, "displayText"},
+        {Qt::TextAlignmentRole, "textAlignment"},
+        {SortRole, "sortValue"},
+        {EnableSort, "enableSort"},
+    };
+}
+
+Qt::ItemFlags ForecastModel::flags(const QModelIndex &index) const
+{
+    Q_ASSERT(checkIndex(index, CheckIndexOption::IndexIsValid | CheckIndexOption::ParentIsInvalid));
+    return Qt::ItemIsSelectable | Qt::ItemIsEnabled;
+}
+
+void ForecastModel::setTournament(Tournament *tournament)
+{
+    m_forecast->cancel();
+
+    beginResetModel();
+    m_tournament = tournament;
+    m_players.clear();
+    m_points.clear();
+    m_results.clear();
+    endResetModel();
+
+    Q_EMIT runningChanged();
+    Q_EMIT progressChanged();
+}
+
+bool ForecastModel::isRunning() const
+{
+    return m_forecast->isRunning();
+}
+
+int ForecastModel::completedSimulations() const
+{
+    return m_forecast->completedSimulations();
+}
+
+int ForecastModel::totalSimulations() const
+{
+    return m_forecast->totalSimulations();
+}
+
+void ForecastModel::start(int simulations)
+{
+    Q_ASSERT(m_tournament != nullptr);
+
+    beginResetModel();
+
+    m_players = m_tournament->playersByStartingRank().values();
+
+    const auto snapshot = PairingSnapshot::fromTournament(m_tournament, m_tournament->currentRound() + 1);
+    m_points.clear();
+    for (int i = 0; i < snapshot.numberOfPlayers(); ++i) {
+        m_points << snapshot.points(i);
+    }
+
+    m_forecast->start(m_tournament, simulations);
+    m_results = m_forecast->results();
+
+    endResetModel();
+
+    Q_EMIT runningChanged();
+    Q_EMIT progressChanged();
+}
+
+void ForecastModel::cancel()
+{
+    m_forecast->cancel();
+}
+
+void ForecastModel::updateResults()
+{
+    // Results of a forecast of the previous tournament
+    if (m_players.isEmpty()) {
+        return;
+    }
+
+    m_results = m_forecast->results();
+
+    if (!m_results.isEmpty()) {
+        Q_EMIT dataChanged(index(0, Points), index(rowCount() - 1, columnCount() - 1));
+    }
+
+    Q_EMIT progressChanged();
+}
+
+#include "moc_forecastmodel.cpp"
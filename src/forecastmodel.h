@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QAbstractTableModel>
+
+#include "tournament/forecast.h"
+
+class Player;
+class Tournament;
+
+class ForecastModel : public QAbstractTableModel
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("")
+
+    Q_PROPERTY(bool running READ isRunning NOTIFY runningChanged)
+    Q_PROPERTY(int completedSimulations READ completedSimulations NOTIFY progressChanged)
+    Q_PROPERTY(int totalSimulations READ totalSimulations NOTIFY progressChanged)
+
+public:
+    enum Columns {
+        StartingRank,
+        Title,
+        Name,
+        Rating,
+        Points,
+        ExpectedPoints,
+        // One column for each rank band follows
+    };
+    Q_ENUM(Columns)
+
+    enum Roles {
+        SortRole = Qt::UserRole,
+        EnableSort,
+    };
+    Q_ENUM(Roles)
+
+    explicit ForecastModel(QObject *parent = nullptr);
+
+    [[nodiscard]] int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    [[nodiscard]] int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    [[nodiscard]] QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    [[nodiscard]] QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
+    [[nodiscard]] Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+    void setTournament(Tournament *tournament);
+
+    [[nodiscard]] bool isRunning() const;
+    [[nodiscard]] int completedSimulations() const;
+    [[nodiscard]] int totalSimulations() const;
+
+    /*!
+     * Starts a forecast of the current tournament with \a simulations simulations.
+     */
+    Q_INVOKABLE void start(int simulations);
+    Q_INVOKABLE void cancel();
+
+Q_SIGNALS:
+    void runningChanged();
+    void progressChanged();
+
+private:
+    void updateResults();
+
+    Tournament *m_tournament = nullptr;
+    Forecast *m_forecast;
+    QList<Player *> m_players;
+    QList<double> m_points;
+    QList<Forecast::PlayerForecast> m_results;
+};
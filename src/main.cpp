@@ -6,6 +6,7 @@
 #include <QIcon>
 #include <QQmlApplicationEngine>
 #include <QQuickStyle>
+#include <QStringList>
 #include <QTextStream>
 #include <QUrl>
 
@@ -18,6 +19,8 @@
 #include <QCoroQml>
 
 #include "controller.h"
+#include "tournament/event.h"
+#include "tournament/pairings/pairingchecker.h"
 
 #ifdef Q_OS_WINDOWS
 #include <QFont>
@@ -26,6 +29,62 @@
 
 using namespace Qt::Literals::StringLiterals;
 
+namespace
+{
+QString pairingsToString(const PairingChecker::Pairings &pairings)
+{
+    QStringList result;
+    for (const auto &[white, black] : pairings) {
+        result << (black == 0 ? u"%1-bye"_s.arg(white) : u"%1-%2"_s.arg(white).arg(black));
+    }
+    return result.join(u", "_s);
+}
+
+// Checks the pairings of every round of a TRF and prints a report.
+// Returns the exit code of the application.
+int checkTrf(const QString &fileName)
+{
+    QTextStream stream{stdout};
+
+    Event event;
+    if (const auto ok = event.create(); !ok) {
+        QTextStream{stderr} << ok.error() << '\n';
+        return 2;
+    }
+
+    const auto tournament = event.importTournament(fileName);
+    if (!tournament) {
+        QTextStream{stderr} << tournament.error() << '\n';
+        return 2;
+    }
+
+    PairingChecker checker{(*tournament)->pairingSystem()};
+    const auto reports = checker.check(*tournament);
+
+    bool valid = true;
+    for (const auto &report : reports) {
+        const auto ms = QString::number(static_cast<double>(report.elapsed.count()) / 1000.0, 'f', 1);
+
+        if (report.matches()) {
+            stream << i18nc("@info:shell %1 is a round number, %2 is a time in milliseconds", "Round %1: OK (%2 ms)", report.round, ms) << '\n';
+            continue;
+        }
+
+        valid = false;
+        if (!report.error.isEmpty()) {
+            stream << i18nc("@info:shell %1 is a round number, %2 is an error message", "Round %1: %2", report.round, report.error) << '\n';
+            continue;
+        }
+
+        stream << i18nc("@info:shell %1 is a round number, %2 is a time in milliseconds", "Round %1: pairings differ (%2 ms)", report.round, ms) << '\n';
+        stream << "  " << i18nc("@info:shell", "Unexpected: %1", pairingsToString(report.unexpected)) << '\n';
+        stream << "  " << i18nc("@info:shell", "Missing: %1", pairingsToString(report.missing)) << '\n';
+    }
+
+    return valid ? 0 : 1;
+}
+}
+
 int main(int argc, char *argv[])
 {
     KIconTheme::initTheme();
@@ -82,13 +141,21 @@ int main(int argc, char *argv[])
     aboutData.setupCommandLine(&parser);
 
     QCommandLineOption trfFile("import-trf"_L1, i18nc("Command line option description", "Import Tournament Report File."), "file"_L1);
+    QCommandLineOption checkFile("check-trf"_L1,
+                                 i18nc("Command line option description", "Check the pairings of a Tournament Report File and exit."),
+                                 "file"_L1);
 
     parser.addOption(trfFile);
+    parser.addOption(checkFile);
     parser.addPositionalArgument(u"file"_s, i18nc("@info:shell Command line option description", "Event to open."));
 
     parser.process(app);
     aboutData.processCommandLine(&parser);
 
+    if (parser.isSet(checkFile)) {
+        return checkTrf(parser.value(checkFile));
+    }
+
     QQmlApplicationEngine engine;
 
     QCoro::Qml::registerTypes();
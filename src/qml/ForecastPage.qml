@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+pragma ComponentBehavior: Bound
+
+import QtQuick
+import QtQuick.Controls as Controls
+
+import org.kde.ki18n
+import org.kde.kitemmodels as KItemModels
+import org.kde.kirigami as Kirigami
+
+import org.kde.chessament
+
+TablePage {
+    id: root
+
+    property int simulations: 10000
+
+    Kirigami.ColumnView.fillWidth: true
+
+    sortColumn: ForecastModel.ExpectedPoints
+    sortOrder: Qt.DescendingOrder
+
+    onColumnClicked: function (index: int): void {
+        if (root.sortColumn === index) {
+            root.sortOrder = root.sortOrder === Qt.AscendingOrder ? Qt.DescendingOrder : Qt.AscendingOrder;
+        } else {
+            root.sortColumn = index;
+        }
+    }
+
+    model: KItemModels.KSortFilterProxyModel {
+        sourceModel: Controller.forecastModel
+
+        sortRoleName: "sortValue"
+        sortColumn: root.sortColumn
+        sortOrder: root.sortOrder
+    }
+
+    function defaultColumnWidth(column: int): int {
+        if (column >= 4) {
+            return 80;
+        }
+        const widths = [55, 55, 300, 70];
+        return widths[column];
+    }
+
+    actions: [
+        Kirigami.Action {
+            icon.name: "media-playback-start-symbolic"
+            text: KI18n.i18nc("@action:intoolbar", "Run Forecast")
+            visible: !Controller.forecastModel.running
+            enabled: Controller.tournament.numberOfPlayers > 1
+            onTriggered: Controller.forecastModel.start(root.simulations)
+        },
+        Kirigami.Action {
+            icon.name: "media-playback-stop-symbolic"
+            text: KI18n.i18nc("@action:intoolbar", "Stop")
+            visible: Controller.forecastModel.running
+            onTriggered: Controller.forecastModel.cancel()
+        },
+        Kirigami.Action {
+            displayHint: Kirigami.DisplayHint.KeepVisible
+            displayComponent: Controls.Label {
+                visible: Controller.forecastModel.totalSimulations > 0
+                text: KI18n.i18nc("@info:status %1 and %2 are numbers of simulations", "%1 of %2 simulations", Controller.forecastModel.completedSimulations, Controller.forecastModel.totalSimulations)
+            }
+        }
+    ]
+
+    delegate: TableDelegate {
+        required property int index
+        required property bool editing
+        required property string displayText
+
+        text: displayText
+    }
+
+    Kirigami.PlaceholderMessage {
+        parent: root
+        anchors.centerIn: parent
+        width: parent.width - Kirigami.Units.gridUnit * 4
+        text: KI18n.i18nc("@info:placeholder", "No forecast yet")
+        explanation: KI18n.i18nc("@info:placeholder", "Simulate the remaining rounds to estimate the chances of each player.")
+        visible: root.tableView.rows === 0
+    }
+}
@@ -134,7 +134,8 @@ StatefulApp.StatefulWindow {
             const components = {
                 [Controller.View.Players]: "PlayersPage",
                 [Controller.View.Pairings]: "PairingsPage",
-                [Controller.View.Standings]: "StandingsPage"
+                [Controller.View.Standings]: "StandingsPage",
+                [Controller.View.Forecast]: "ForecastPage"
             };
             const pageName = components[view];
 
@@ -69,6 +69,14 @@ Kirigami.OverlayDrawer {
             onClicked: root.goToPage(Controller.View.Standings)
         }
 
+        Kirigami.NavigationTabButton {
+            Layout.fillWidth: true
+            text: KI18n.i18n("Forecast")
+            icon.name: "office-chart-bar-symbolic"
+            checked: Controller.currentView === Controller.View.Forecast
+            onClicked: root.goToPage(Controller.View.Forecast)
+        }
+
         Item {
             Layout.fillHeight: true
         }
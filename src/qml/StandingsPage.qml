@@ -56,6 +56,14 @@ TablePage {
         onAccepted: Controller.saveStandingsDocument(selectedFile, root.round)
     }
 
+    Dialogs.FileDialog {
+        id: saveHistoryDialog
+        fileMode: Dialogs.FileDialog.SaveFile
+        nameFilters: [KI18n.i18nc("@label:listbox", "PDF document (*.pdf)")]
+        currentFolder: StandardPaths.standardLocations(StandardPaths.HomeLocation)[0]
+        onAccepted: Controller.saveStandingsHistoryDocument(selectedFile)
+    }
+
     actions: [
         Kirigami.Action {
             id: printAction
@@ -70,6 +78,20 @@ TablePage {
             enabled: root.content.visible
             onTriggered: saveDialog.open()
         },
+        Kirigami.Action {
+            icon.name: "document-print-symbolic"
+            text: KI18n.i18nc("@action:intoolbar", "Print Standings After Each Round…")
+            displayHint: Kirigami.DisplayHint.AlwaysHide
+            enabled: root.content.visible
+            onTriggered: Controller.printStandingsHistoryDocument()
+        },
+        Kirigami.Action {
+            icon.name: "document-export-symbolic"
+            text: KI18n.i18nc("@action:intoolbar", "Export Standings After Each Round as PDF…")
+            displayHint: Kirigami.DisplayHint.AlwaysHide
+            enabled: root.content.visible
+            onTriggered: saveHistoryDialog.open()
+        },
         Kirigami.Action {
             displayHint: Kirigami.DisplayHint.KeepVisible
             displayComponent: Controls.ComboBox {
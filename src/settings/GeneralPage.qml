@@ -29,4 +29,32 @@ FormCard.FormCardPage {
             }
         }
     }
+
+    FormCard.FormHeader {
+        title: KI18n.i18nc("@title:group", "Event Files")
+    }
+
+    FormCard.FormCard {
+        FormCard.FormSwitchDelegate {
+            text: KI18n.i18nc("@option:check", "Fast saving")
+            description: KI18n.i18nc("@info", "Changes are saved faster, but the last ones may be lost after a power failure. Applies to the next opened event.")
+            checked: Config.writeAheadLog
+            onToggled: {
+                Config.writeAheadLog = checked;
+                Config.save();
+            }
+        }
+
+        FormCard.FormDelegateSeparator {}
+
+        FormCard.FormSwitchDelegate {
+            text: KI18n.i18nc("@option:check", "Overwrite deleted data")
+            description: KI18n.i18nc("@info", "Deleted players and pairings can't be recovered from the file. Applies to the next opened event.")
+            checked: Config.secureDelete
+            onToggled: {
+                Config.secureDelete = checked;
+                Config.save();
+            }
+        }
+    }
 }
@@ -97,7 +97,7 @@ QVariant StandingsModel::headerData(int section, Qt::Orientation orientation, in
         case NameRole:
             return i18nc("@title:column Player Name", "Name");
         default: {
-            const auto tiebreak = m_tournament->tiebreaks().at(section - 4);
+            const auto &tiebreak = m_tournament->tiebreaks().compiled().at(section - 4);
             if (!tiebreak->shortName().isNull()) {
                 return tiebreak->shortName();
             }
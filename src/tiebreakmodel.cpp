@@ -35,7 +35,7 @@ QVariant TiebreakModel::data(const QModelIndex &index, int role) const
 {
     Q_ASSERT(checkIndex(index, CheckIndexOption::IndexIsValid | CheckIndexOption::ParentIsInvalid));
 
-    const auto &tiebreak = m_tournament->tiebreaks().at(index.row());
+    const auto &tiebreak = m_tournament->tiebreaks().compiled().at(index.row());
 
     switch (role) {
     case Qt::DisplayRole:
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generates random tournaments and saves them as Tournament Report Files (TRF),
+// to be used in benchmarks and stress tests.
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QCoroTask>
+#include <QElapsedTimer>
+#include <QTextStream>
+
+#include "event.h"
+#include "generator.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(u"Generate a random tournament and save it as a TRF."_s);
+    parser.addHelpOption();
+
+    const TournamentGenerator::Options defaults;
+
+    QCommandLineOption players(u"players"_s, u"Number of players."_s, u"n"_s, QString::number(defaults.players));
+    QCommandLineOption rounds(u"rounds"_s, u"Number of rounds."_s, u"n"_s, QString::number(defaults.rounds));
+    QCommandLineOption system(u"system"_s, u"Pairing system: dutch, burstein, dubov, lim, round-robin or double-round-robin."_s, u"system"_s, u"dutch"_s);
+    QCommandLineOption distribution(u"distribution"_s, u"Rating distribution: normal or uniform."_s, u"distribution"_s, u"normal"_s);
+    QCommandLineOption mean(u"rating-mean"_s, u"Mean rating of the normal distribution."_s, u"rating"_s, QString::number(defaults.ratingMean));
+    QCommandLineOption deviation(u"rating-deviation"_s,
+                                 u"Standard deviation of the normal distribution."_s,
+                                 u"rating"_s,
+                                 QString::number(defaults.ratingDeviation));
+    QCommandLineOption minRating(u"min-rating"_s, u"Minimum rating."_s, u"rating"_s, QString::number(defaults.minRating));
+    QCommandLineOption maxRating(u"max-rating"_s, u"Maximum rating."_s, u"rating"_s, QString::number(defaults.maxRating));
+    QCommandLineOption drawRate(u"draw-rate"_s, u"Fraction of draws between equally rated players."_s, u"rate"_s, QString::number(defaults.drawRate));
+    QCommandLineOption byes(u"bye-probability"_s, u"Probability of a requested bye."_s, u"p"_s, QString::number(defaults.byeProbability));
+    QCommandLineOption forfeits(u"forfeit-probability"_s, u"Probability of a forfeit."_s, u"p"_s, QString::number(defaults.forfeitProbability));
+    QCommandLineOption seed(u"seed"_s, u"Seed of the random generator."_s, u"seed"_s, QString::number(defaults.seed));
+
+    parser.addOptions({players, rounds, system, distribution, mean, deviation, minRating, maxRating, drawRate, byes, forfeits, seed});
+    parser.addPositionalArgument(u"output"_s, u"TRF file to write."_s);
+
+    parser.process(app);
+
+    if (parser.positionalArguments().size() != 1) {
+        parser.showHelp(1);
+    }
+
+    TournamentGenerator::Options options;
+    options.players = parser.value(players).toInt();
+    options.rounds = parser.value(rounds).toInt();
+    options.ratingMean = parser.value(mean).toDouble();
+    options.ratingDeviation = parser.value(deviation).toDouble();
+    options.minRating = parser.value(minRating).toInt();
+    options.maxRating = parser.value(maxRating).toInt();
+    options.drawRate = parser.value(drawRate).toDouble();
+    options.byeProbability = parser.value(byes).toDouble();
+    options.forfeitProbability = parser.value(forfeits).toDouble();
+    options.seed = parser.value(seed).toULongLong();
+
+    const auto systemName = parser.value(system);
+    if (systemName == "dutch"_L1) {
+        options.pairingSystem = Tournament::PairingSystem::Dutch;
+    } else if (systemName == "burstein"_L1) {
+        options.pairingSystem = Tournament::PairingSystem::Burstein;
+    } else if (systemName == "dubov"_L1) {
+        options.pairingSystem = Tournament::PairingSystem::Dubov;
+    } else if (systemName == "lim"_L1) {
+        options.pairingSystem = Tournament::PairingSystem::Lim;
+    } else if (systemName == "round-robin"_L1) {
+        options.pairingSystem = Tournament::PairingSystem::RoundRobin;
+    } else if (systemName == "double-round-robin"_L1) {
+        options.pairingSystem = Tournament::PairingSystem::DoubleRoundRobin;
+    } else {
+        QTextStream{stderr} << "Unknown pairing system: " << systemName << '\n';
+        return 1;
+    }
+
+    const auto distributionName = parser.value(distribution);
+    if (distributionName == "normal"_L1) {
+        options.ratingDistribution = TournamentGenerator::RatingDistribution::Normal;
+    } else if (distributionName == "uniform"_L1) {
+        options.ratingDistribution = TournamentGenerator::RatingDistribution::Uniform;
+    } else {
+        QTextStream{stderr} << "Unknown rating distribution: " << distributionName << '\n';
+        return 1;
+    }
+
+    if (options.players < 2 || options.rounds < 1 || options.minRating > options.maxRating) {
+        QTextStream{stderr} << "Invalid options\n";
+        return 1;
+    }
+
+    Event event;
+    if (const auto ok = event.create(); !ok) {
+        QTextStream{stderr} << ok.error() << '\n';
+        return 1;
+    }
+
+    const auto tournament = event.createTournament();
+    if (!tournament) {
+        QTextStream{stderr} << tournament.error() << '\n';
+        return 1;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    TournamentGenerator generator{options};
+    if (const auto ok = QCoro::waitFor(generator.generate(*tournament)); !ok) {
+        QTextStream{stderr} << ok.error() << '\n';
+        return 1;
+    }
+
+    if (!(*tournament)->exportTrf(parser.positionalArguments().constFirst())) {
+        QTextStream{stderr} << "Could not write " << parser.positionalArguments().constFirst() << '\n';
+        return 1;
+    }
+
+    QTextStream{stdout} << "Generated " << options.players << " players and " << options.rounds << " rounds in " << timer.elapsed() << " ms\n";
+
+    return 0;
+}
@@ -14,10 +14,29 @@ constexpr auto SQLITE_NOTADB = "26"_L1;
 // SQLite Application ID
 constexpr int CHESSAMENT_MAGIC_APPLICATION_ID = 937847437;
 
+// Version of the database schema, stored in user_version
+constexpr int CHESSAMENT_DB_VERSION = 2;
+
 constexpr auto ENABLE_FOREIGN_KEYS_QUERY = "PRAGMA foreign_keys = ON;"_L1;
 
 const QString ENABLE_SECURE_DELETE_QUERY = u"PRAGMA secure_delete = ON;"_s;
 
+const QString DISABLE_SECURE_DELETE_QUERY = u"PRAGMA secure_delete = OFF;"_s;
+
+const QString WAL_JOURNAL_MODE_QUERY = u"PRAGMA journal_mode = WAL;"_s;
+
+const QString DELETE_JOURNAL_MODE_QUERY = u"PRAGMA journal_mode = DELETE;"_s;
+
+const QString NORMAL_SYNCHRONOUS_QUERY = u"PRAGMA synchronous = NORMAL;"_s;
+
+const QString FULL_SYNCHRONOUS_QUERY = u"PRAGMA synchronous = FULL;"_s;
+
+// Copies as much of the log as possible without waiting for readers or writers
+const QString PASSIVE_CHECKPOINT_QUERY = u"PRAGMA wal_checkpoint(PASSIVE);"_s;
+
+// Copies the whole log and truncates it
+const QString TRUNCATE_CHECKPOINT_QUERY = u"PRAGMA wal_checkpoint(TRUNCATE);"_s;
+
 const QString TOURNAMENTS_TABLE_SCHEMA =
     u"CREATE TABLE IF NOT EXISTS tournaments("_s
     u"id TEXT PRIMARY KEY"_s
@@ -136,3 +155,29 @@ static_assert(std::to_underlying(Pairing::PartialResult::ZeroBye) == 11);
 const QString DELETE_PAIRINGS_KEEP_BYES_QUERY = u"DELETE FROM pairings WHERE round = :round AND whiteResult NOT IN (9, 10, 11);"_s;
 
 const QString DELETE_PAIRINGS_OF_PLAYER_QUERY = u"DELETE FROM pairings WHERE whitePlayer = :id OR blackPlayer = :id;"_s;
+
+const QString PAIRING_CACHE_TABLE_SCHEMA =
+    u"CREATE TABLE IF NOT EXISTS pairing_cache("_s
+    u"tournament TEXT NOT NULL,"_s
+    u"key BLOB NOT NULL,"_s
+    u"round INTEGER NOT NULL,"_s
+    u"pairings BLOB NOT NULL,"_s
+    u"lastUsed INTEGER,"_s
+    u"PRIMARY KEY (tournament, key),"_s
+    u"FOREIGN KEY (tournament) REFERENCES tournaments(id)"_s
+    u");"_s;
+
+const QString GET_CACHED_PAIRINGS_QUERY = u"SELECT pairings FROM pairing_cache WHERE tournament = :tournament AND key = :key;"_s;
+
+const QString TOUCH_CACHED_PAIRINGS_QUERY = u"UPDATE pairing_cache SET lastUsed = :lastUsed WHERE tournament = :tournament AND key = :key;"_s;
+
+const QString ADD_CACHED_PAIRINGS_QUERY =
+    u"INSERT OR REPLACE INTO pairing_cache(tournament, key, round, pairings, lastUsed) "_s
+    u"VALUES (:tournament, :key, :round, :pairings, :lastUsed);"_s;
+
+const QString PRUNE_CACHED_PAIRINGS_QUERY =
+    u"DELETE FROM pairing_cache WHERE tournament = :tournament AND round = :round AND key NOT IN ("_s
+    u"SELECT key FROM pairing_cache WHERE tournament = :tournament AND round = :round ORDER BY lastUsed DESC LIMIT :limit"_s
+    u");"_s;
+
+const QString CLEAR_CACHED_PAIRINGS_QUERY = u"DELETE FROM pairing_cache WHERE tournament = :tournament;"_s;
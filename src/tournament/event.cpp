@@ -7,6 +7,7 @@
 #include <QSqlError>
 #include <QSqlQuery>
 #include <QSqlRecord>
+#include <QtConcurrentRun>
 
 #include "db.h"
 
@@ -29,6 +30,30 @@ void Event::setFileName(const QString &fileName)
     Q_EMIT fileNameChanged();
 }
 
+Event::Durability Event::durability() const
+{
+    return m_durability;
+}
+
+void Event::setDurability(Durability durability)
+{
+    Q_ASSERT(m_connName.isEmpty());
+
+    m_durability = durability;
+}
+
+bool Event::secureDelete() const
+{
+    return m_secureDelete;
+}
+
+void Event::setSecureDelete(bool secureDelete)
+{
+    Q_ASSERT(m_connName.isEmpty());
+
+    m_secureDelete = secureDelete;
+}
+
 size_t Event::numberOfTournaments()
 {
     return m_tournaments.size();
@@ -94,8 +119,31 @@ std::expected<Tournament *, QString> Event::importTournament(const QString &file
     return m_tournaments.back().get();
 }
 
+std::expected<void, QString> Event::checkpoint()
+{
+    if (!m_writeAheadLog) {
+        return {};
+    }
+
+    // Otherwise this one could find the log busy
+    m_checkpoint.waitForFinished();
+
+    QSqlQuery query(TRUNCATE_CHECKPOINT_QUERY, db());
+
+    if (query.lastError().isValid()) {
+        qDebug() << "checkpoint" << query.lastError();
+        return std::unexpected(query.lastError().text());
+    }
+
+    return {};
+}
+
 std::expected<void, QString> Event::saveAs(const QString &fileName)
 {
+    if (const auto ok = checkpoint(); !ok) {
+        return ok;
+    }
+
     QSqlQuery query(db());
     query.prepare(u"VACUUM INTO :fileName;"_s);
     query.bindValue(u":fileName"_s, fileName);
@@ -125,6 +173,22 @@ QSqlDatabase Event::db()
     return QSqlDatabase::database(m_connName);
 }
 
+StatementCache &Event::statements()
+{
+    Q_ASSERT(m_statements);
+
+    return *m_statements;
+}
+
+QList<StatementCache::Statistics> Event::statementStatistics() const
+{
+    if (!m_statements) {
+        return {};
+    }
+
+    return m_statements->statistics();
+}
+
 std::expected<void, QString> Event::openDatabase(const QString &dbName)
 {
     Q_ASSERT(m_connName.isEmpty());
@@ -139,6 +203,8 @@ std::expected<void, QString> Event::openDatabase(const QString &dbName)
         return std::unexpected(db.lastError().text());
     }
 
+    m_statements = std::make_unique<StatementCache>(db);
+
     QSqlQuery query(db);
     query.prepare(ENABLE_FOREIGN_KEYS_QUERY);
 
@@ -148,10 +214,10 @@ std::expected<void, QString> Event::openDatabase(const QString &dbName)
     }
 
     query = QSqlQuery(db);
-    query.prepare(ENABLE_SECURE_DELETE_QUERY);
+    query.prepare(m_secureDelete ? ENABLE_SECURE_DELETE_QUERY : DISABLE_SECURE_DELETE_QUERY);
 
     if (!query.exec()) {
-        qWarning() << "Error enabling secure delete" << query.lastError().text();
+        qWarning() << "Error setting secure delete" << query.lastError().text();
         return std::unexpected(query.lastError().text());
     }
 
@@ -174,6 +240,11 @@ std::expected<void, QString> Event::openDatabase(const QString &dbName)
         if (applicationId != CHESSAMENT_MAGIC_APPLICATION_ID) {
             return std::unexpected(xi18nc("@info", "The file is not a <application>Chessament</application> event."));
         }
+
+        if (const auto ok = upgradeTables(); !ok) {
+            qDebug() << "Error upgrading tables" << ok.error();
+            return ok;
+        }
     } else {
         if (const auto ok = createTables(); !ok) {
             qDebug() << "Error creating tables" << ok.error();
@@ -181,11 +252,95 @@ std::expected<void, QString> Event::openDatabase(const QString &dbName)
         }
     }
 
+    if (const auto ok = setUpJournal(dbName == ":memory:"_L1); !ok) {
+        qDebug() << "Error setting up the journal" << ok.error();
+        return ok;
+    }
+
+    return {};
+}
+
+std::expected<void, QString> Event::setUpJournal(bool inMemory)
+{
+    if (inMemory) {
+        return {};
+    }
+
+    const bool writeAheadLog = m_durability == Durability::WriteAheadLog;
+
+    // The journal mode is stored in the file, so it has to be set in both cases
+    QSqlQuery query(writeAheadLog ? WAL_JOURNAL_MODE_QUERY : DELETE_JOURNAL_MODE_QUERY, db());
+
+    if (query.lastError().isValid()) {
+        return std::unexpected(query.lastError().text());
+    }
+
+    query.next();
+
+    // Some file systems don't support a write-ahead log
+    m_writeAheadLog = query.value(0).toString().compare("wal"_L1, Qt::CaseInsensitive) == 0;
+    if (writeAheadLog && !m_writeAheadLog) {
+        qWarning() << "Could not enable the write-ahead log, using" << query.value(0).toString();
+    }
+
+    query = QSqlQuery(m_writeAheadLog ? NORMAL_SYNCHRONOUS_QUERY : FULL_SYNCHRONOUS_QUERY, db());
+
+    if (query.lastError().isValid()) {
+        return std::unexpected(query.lastError().text());
+    }
+
+    if (m_writeAheadLog) {
+        m_checkpointTimer.setInterval(CheckpointInterval);
+        connect(&m_checkpointTimer, &QTimer::timeout, this, &Event::checkpointInBackground, Qt::UniqueConnection);
+        m_checkpointTimer.start();
+    }
+
     return {};
 }
 
+void Event::checkpointInBackground()
+{
+    // The previous checkpoint is still running
+    if (!m_checkpoint.isFinished()) {
+        return;
+    }
+
+    // Connections can't be shared between threads, so the checkpoint uses its own
+    m_checkpoint = QtConcurrent::run([fileName = db().databaseName()] {
+        const auto connName = QUuid::createUuid().toString(QUuid::WithoutBraces);
+
+        {
+            auto db = QSqlDatabase::addDatabase(u"QSQLITE"_s, connName);
+            db.setDatabaseName(fileName);
+
+            if (!db.open()) {
+                qDebug() << "checkpoint" << db.lastError();
+            } else {
+                QSqlQuery query(PASSIVE_CHECKPOINT_QUERY, db);
+
+                if (query.lastError().isValid()) {
+                    qDebug() << "checkpoint" << query.lastError();
+                }
+            }
+        }
+
+        QSqlDatabase::removeDatabase(connName);
+    });
+}
+
 void Event::closeDatabase()
 {
+    m_checkpointTimer.stop();
+    m_checkpoint.waitForFinished();
+
+    // The prepared statements have to be finalized before closing the connection
+    m_statements.reset();
+
+    if (const auto ok = checkpoint(); !ok) {
+        qWarning() << "Could not checkpoint the write-ahead log" << ok.error();
+    }
+    m_writeAheadLog = false;
+
     db().close();
     QSqlDatabase::removeDatabase(m_connName);
 }
@@ -227,7 +382,14 @@ std::expected<void, QString> Event::createTables()
         return std::unexpected(query.lastError().text());
     }
 
-    if (const auto ok = setDbVersion(1); !ok) {
+    query = QSqlQuery(db());
+    query.prepare(PAIRING_CACHE_TABLE_SCHEMA);
+
+    if (!query.exec()) {
+        return std::unexpected(query.lastError().text());
+    }
+
+    if (const auto ok = setDbVersion(CHESSAMENT_DB_VERSION); !ok) {
         return ok;
     }
 
@@ -241,6 +403,30 @@ std::expected<void, QString> Event::createTables()
     return {};
 }
 
+std::expected<void, QString> Event::upgradeTables()
+{
+    const auto version = dbVersion();
+    if (!version) {
+        return std::unexpected(version.error());
+    }
+
+    if (*version >= CHESSAMENT_DB_VERSION) {
+        return {};
+    }
+
+    // Version 2: pairing cache
+    if (*version < 2) {
+        QSqlQuery query(db());
+        query.prepare(PAIRING_CACHE_TABLE_SCHEMA);
+
+        if (!query.exec()) {
+            return std::unexpected(query.lastError().text());
+        }
+    }
+
+    return setDbVersion(CHESSAMENT_DB_VERSION);
+}
+
 std::expected<int, QString> Event::dbVersion()
 {
     QSqlQuery query(u"PRAGMA user_version;"_s, db());
@@ -249,6 +435,8 @@ std::expected<int, QString> Event::dbVersion()
         return std::unexpected(query.lastError().text());
     }
 
+    query.next();
+
     return query.value(0).toInt();
 }
 
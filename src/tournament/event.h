@@ -3,10 +3,16 @@
 
 #pragma once
 
+#include <QFuture>
 #include <QObject>
 #include <QSqlDatabase>
 #include <QString>
+#include <QTimer>
 
+#include <chrono>
+#include <memory>
+
+#include "statementcache.h"
 #include "tournament.h"
 
 /*!
@@ -23,6 +29,30 @@ class Event : public QObject
     Q_PROPERTY(QString fileName READ fileName WRITE setFileName NOTIFY fileNameChanged)
 
 public:
+    /*!
+     * \enum Event::Durability
+     *
+     * How changes are written to the event file.
+     *
+     * \value Full
+     *        Changes are written with a rollback journal, and the file is synced
+     *        on every commit.
+     * \value WriteAheadLog
+     *        Changes are appended to a write-ahead log, which is only synced when
+     *        it is copied back to the file. The log is copied periodically in the
+     *        background, and when the event is closed or saved. A power failure
+     *        may lose the last changes, but never corrupts the file.
+     */
+    enum class Durability {
+        Full,
+        WriteAheadLog,
+    };
+
+    /*!
+     * Interval between the background checkpoints of the write-ahead log.
+     */
+    static constexpr std::chrono::seconds CheckpointInterval{30};
+
     explicit Event() = default;
 
     ~Event() override;
@@ -40,6 +70,33 @@ public:
      */
     size_t numberOfTournaments();
 
+    /*!
+     * Returns how changes are written to the event file.
+     */
+    [[nodiscard]] Durability durability() const;
+
+    /*!
+     * Sets how changes are written to the event file. It must be set before the
+     * event is created or opened.
+     *
+     * The default is Durability::WriteAheadLog. Events in memory always use a
+     * rollback journal in memory.
+     */
+    void setDurability(Durability durability);
+
+    /*!
+     * Returns whether deleted data is overwritten with zeros.
+     */
+    [[nodiscard]] bool secureDelete() const;
+
+    /*!
+     * Sets whether deleted data is overwritten with zeros, so it can't be recovered
+     * from the event file. It must be set before the event is created or opened.
+     *
+     * It is enabled by default.
+     */
+    void setSecureDelete(bool secureDelete);
+
     std::expected<void, QString> create(const QString &fileName = {});
 
     std::expected<void, QString> open(const QString &fileName);
@@ -61,6 +118,14 @@ public:
      */
     std::expected<Tournament *, QString> importTournament(const QString &fileName);
 
+    /*!
+     * Copies the changes in the write-ahead log to the event file, and truncates
+     * the log.
+     *
+     * Does nothing if the event doesn't use Durability::WriteAheadLog.
+     */
+    std::expected<void, QString> checkpoint();
+
     /*!
      * Saves the event in a new file.
      *
@@ -75,6 +140,12 @@ public:
      */
     bool remove();
 
+    /*!
+     * Returns the number of executions and the time spent in every statement
+     * run through the statement cache, starting with the slowest one overall.
+     */
+    [[nodiscard]] QList<StatementCache::Statistics> statementStatistics() const;
+
 public Q_SLOTS:
     void setFileName(const QString &fileName);
 
@@ -83,16 +154,31 @@ Q_SIGNALS:
 
 private:
     QSqlDatabase db();
+    StatementCache &statements();
     std::expected<void, QString> openDatabase(const QString &dbName);
     void closeDatabase();
     std::expected<void, QString> createTables();
+    std::expected<void, QString> upgradeTables();
     std::expected<int, QString> dbVersion();
     std::expected<void, QString> setDbVersion(int version);
     std::expected<void, QString> loadTournaments();
+    std::expected<void, QString> setUpJournal(bool inMemory);
+    void checkpointInBackground();
 
     QString m_connName;
     QString m_fileName;
 
+    Durability m_durability = Durability::WriteAheadLog;
+    bool m_secureDelete = true;
+
+    // Whether the connection is using a write-ahead log
+    bool m_writeAheadLog = false;
+    QTimer m_checkpointTimer;
+    QFuture<void> m_checkpoint;
+
+    // Prepared statements of the connection
+    std::unique_ptr<StatementCache> m_statements;
+
     std::vector<std::unique_ptr<Tournament>> m_tournaments;
 
     friend class Tournament;
@@ -0,0 +1,300 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "forecast.h"
+
+#include <QMutex>
+#include <QRandomGenerator>
+#include <QThread>
+#include <QtConcurrentRun>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "generator.h"
+#include "pairings/builtinbackend.h"
+#include "pairings/pairingsnapshot.h"
+#include "pairings/roundrobin.h"
+#include "tournament.h"
+
+namespace
+{
+// Simulations done by a worker before merging its results
+constexpr int BatchSize = 32;
+
+constexpr double DrawRate = 0.3;
+}
+
+struct Forecast::Run {
+    // Tournament before the simulated games, read-only while running
+    PairingSnapshot snapshot;
+    int currentRound = 0;
+    int numberOfRounds = 0;
+    std::vector<std::pair<int, int>> pendingGames;
+    std::vector<std::pair<int, Pairing::PartialResult>> requestedByes;
+    SwissPairingEngine::System system = SwissPairingEngine::System::Dutch;
+    bool roundRobin = false;
+    bool doubleRoundRobin = false;
+    QList<int> bands;
+    int total = 0;
+
+    std::atomic<int> claimed{0};
+    std::atomic<int> activeWorkers{0};
+    std::atomic<bool> cancelled{false};
+
+    QMutex mutex;
+    int completed = 0;
+    std::vector<double> points;
+    std::vector<int> bandCounts;
+
+    void simulate(SwissPairingEngine &engine, std::mt19937_64 &random, std::vector<double> &points, std::vector<int> &bandCounts) const;
+};
+
+void Forecast::Run::simulate(SwissPairingEngine &engine, std::mt19937_64 &random, std::vector<double> &totalPoints, std::vector<int> &totalBandCounts) const
+{
+    auto tournament = snapshot;
+    const auto numberOfPlayers = tournament.numberOfPlayers();
+
+    std::uniform_real_distribution<double> uniform;
+    const auto play = [&](int white, int black) {
+        return TournamentGenerator::sampleResult(tournament.rating(white), tournament.rating(black), DrawRate, uniform(random));
+    };
+
+    for (const auto &[white, black] : pendingGames) {
+        const auto [whiteResult, blackResult] = play(white, black);
+        tournament.setResult(currentRound - 1, white, whiteResult);
+        tournament.setResult(currentRound - 1, black, blackResult);
+    }
+
+    for (int round = currentRound + 1; round <= numberOfRounds; ++round) {
+        const auto pairs = roundRobin ? std::optional(BergerTables::pairings(numberOfPlayers, round - 1, doubleRoundRobin)) : engine.pair(tournament);
+        if (!pairs) {
+            break;
+        }
+
+        const auto r = tournament.addRound();
+
+        if (round == currentRound + 1) {
+            for (const auto &[player, result] : requestedByes) {
+                tournament.setBye(r, player, result);
+            }
+            for (int i = 0; i < numberOfPlayers; ++i) {
+                tournament.setAvailable(i, true);
+            }
+        }
+
+        for (const auto &[white, black] : *pairs) {
+            if (black < 0) {
+                tournament.setBye(r, white, roundRobin ? Pairing::PartialResult::ZeroBye : Pairing::PartialResult::PairingBye);
+            } else {
+                const auto [whiteResult, blackResult] = play(white, black);
+                tournament.setGame(r, white, black, whiteResult, blackResult);
+            }
+        }
+    }
+
+    std::vector<double> points(numberOfPlayers);
+    for (int i = 0; i < numberOfPlayers; ++i) {
+        points[i] = tournament.points(i);
+        totalPoints[i] += points[i];
+    }
+
+    auto sorted = points;
+    std::ranges::sort(sorted, std::greater{});
+
+    for (int i = 0; i < numberOfPlayers; ++i) {
+        const auto rank = 1 + static_cast<int>(std::ranges::lower_bound(sorted, points[i], std::greater{}) - sorted.cbegin());
+        for (int band = 0; band < bands.size(); ++band) {
+            if (rank <= bands[band]) {
+                totalBandCounts[static_cast<std::size_t>(i * bands.size() + band)]++;
+            }
+        }
+    }
+}
+
+Forecast::Forecast(QObject *parent)
+    : QObject(parent)
+{
+    // Keep the global pool free for pairing the tournament
+    m_pool.setMaxThreadCount(QThread::idealThreadCount());
+}
+
+Forecast::~Forecast()
+{
+    cancel();
+    wait();
+}
+
+QList<int> Forecast::bands() const
+{
+    return m_bands;
+}
+
+void Forecast::setBands(const QList<int> &bands)
+{
+    m_bands = bands;
+}
+
+void Forecast::start(Tournament *tournament, int simulations)
+{
+    cancel();
+    wait();
+
+    auto run = std::make_shared<Run>();
+    run->currentRound = tournament->currentRound();
+    run->numberOfRounds = tournament->numberOfRounds();
+    run->snapshot = PairingSnapshot::fromTournament(tournament, run->currentRound + 1);
+    run->roundRobin = tournament->isRoundRobin();
+    run->doubleRoundRobin = tournament->pairingSystem() == Tournament::PairingSystem::DoubleRoundRobin;
+    if (run->roundRobin) {
+        run->numberOfRounds = std::min(run->numberOfRounds, BergerTables::numberOfRounds(run->snapshot.numberOfPlayers(), run->doubleRoundRobin));
+    } else {
+        run->system = BuiltInPairingBackend::engineSystem(tournament->pairingSystem());
+    }
+    run->bands = m_bands;
+    run->total = simulations;
+
+    if (run->currentRound >= 1) {
+        const auto pairings = tournament->pairings(run->currentRound);
+        for (const auto &pairing : pairings) {
+            if (pairing->blackPlayer() != nullptr
+                && (pairing->whiteResult() == Pairing::PartialResult::Unknown || pairing->blackResult() == Pairing::PartialResult::Unknown)) {
+                run->pendingGames.emplace_back(pairing->whitePlayer()->startingRank() - 1, pairing->blackPlayer()->startingRank() - 1);
+            }
+        }
+    }
+
+    const auto pairings = tournament->pairings(run->currentRound + 1);
+    for (const auto &pairing : pairings) {
+        if (pairing->blackPlayer() == nullptr && Pairing::isVoluntaryBye(pairing->whiteResult())) {
+            run->requestedByes.emplace_back(pairing->whitePlayer()->startingRank() - 1, pairing->whiteResult());
+        }
+    }
+
+    const auto numberOfPlayers = static_cast<std::size_t>(run->snapshot.numberOfPlayers());
+    run->points.resize(numberOfPlayers, 0.);
+    run->bandCounts.resize(numberOfPlayers * m_bands.size(), 0);
+
+    m_run = run;
+
+    const auto workers = m_pool.maxThreadCount();
+    run->activeWorkers = workers;
+
+    for (int i = 0; i < workers; ++i) {
+        const auto seed = QRandomGenerator::global()->generate64();
+
+        m_workers << QtConcurrent::run(&m_pool, [this, run, seed]() {
+            std::mt19937_64 random{seed};
+            SwissPairingEngine engine{run->system};
+
+            const auto size = run->points.size();
+            std::vector<double> points(size);
+            std::vector<int> bandCounts(run->bandCounts.size());
+
+            while (!run->cancelled) {
+                const auto begin = run->claimed.fetch_add(BatchSize);
+                if (begin >= run->total) {
+                    break;
+                }
+                const auto count = std::min(BatchSize, run->total - begin);
+
+                std::ranges::fill(points, 0.);
+                std::ranges::fill(bandCounts, 0);
+
+                for (int j = 0; j < count; ++j) {
+                    run->simulate(engine, random, points, bandCounts);
+                }
+
+                {
+                    QMutexLocker locker(&run->mutex);
+                    for (std::size_t j = 0; j < size; ++j) {
+                        run->points[j] += points[j];
+                    }
+                    for (std::size_t j = 0; j < bandCounts.size(); ++j) {
+                        run->bandCounts[j] += bandCounts[j];
+                    }
+                    run->completed += count;
+                }
+
+                QMetaObject::invokeMethod(this, &Forecast::progress, Qt::QueuedConnection);
+            }
+
+            if (--run->activeWorkers == 0) {
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, run]() {
+                        if (m_run == run) {
+                            Q_EMIT finished();
+                        }
+                    },
+                    Qt::QueuedConnection);
+            }
+        });
+    }
+}
+
+void Forecast::cancel()
+{
+    if (m_run) {
+        m_run->cancelled = true;
+    }
+}
+
+void Forecast::wait()
+{
+    for (auto &worker : m_workers) {
+        worker.waitForFinished();
+    }
+    m_workers.clear();
+}
+
+bool Forecast::isRunning() const
+{
+    return m_run && m_run->activeWorkers > 0;
+}
+
+int Forecast::completedSimulations() const
+{
+    if (!m_run) {
+        return 0;
+    }
+
+    QMutexLocker locker(&m_run->mutex);
+    return m_run->completed;
+}
+
+int Forecast::totalSimulations() const
+{
+    return m_run ? m_run->total : 0;
+}
+
+QList<Forecast::PlayerForecast> Forecast::results() const
+{
+    if (!m_run) {
+        return {};
+    }
+
+    QMutexLocker locker(&m_run->mutex);
+
+    const auto completed = std::max(1, m_run->completed);
+    const auto bands = m_run->bands.size();
+
+    QList<PlayerForecast> results;
+    results.reserve(static_cast<qsizetype>(m_run->points.size()));
+
+    for (std::size_t i = 0; i < m_run->points.size(); ++i) {
+        PlayerForecast forecast;
+        forecast.expectedPoints = m_run->points[i] / completed;
+        for (qsizetype band = 0; band < bands; ++band) {
+            forecast.probabilities << static_cast<double>(m_run->bandCounts[i * static_cast<std::size_t>(bands) + static_cast<std::size_t>(band)]) / completed;
+        }
+        results << forecast;
+    }
+
+    return results;
+}
+
+#include "moc_forecast.cpp"
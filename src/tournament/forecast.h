@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QFuture>
+#include <QList>
+#include <QObject>
+#include <QThreadPool>
+
+#include <memory>
+
+class Tournament;
+
+/*!
+ * \class Forecast
+ * \inmodule tournament
+ * \inheaderfile tournament/forecast.h
+ *
+ * \brief Estimates the final standings of a tournament with Monte Carlo simulations.
+ *
+ * The remaining games of the tournament are played out many times. Results are
+ * drawn from the Elo expected score of each game, and the rounds are paired with
+ * the built-in engine. Simulations work on PairingSnapshot copies of the
+ * tournament and are spread across all the cores, each thread with its own random
+ * generator.
+ *
+ * The final rank of a player is one plus the number of players with more points;
+ * tiebreaks are not considered, so tied players share their rank.
+ */
+class Forecast : public QObject
+{
+    Q_OBJECT
+
+public:
+    /*!
+     * \class Forecast::PlayerForecast
+     * \inmodule tournament
+     *
+     * \brief Forecast of a player.
+     */
+    struct PlayerForecast {
+        /*!
+         * Average number of points at the end of the tournament.
+         */
+        double expectedPoints = 0.;
+
+        /*!
+         * Probability of finishing in each rank band.
+         *
+         * \sa bands()
+         */
+        QList<double> probabilities;
+    };
+
+    explicit Forecast(QObject *parent = nullptr);
+    ~Forecast() override;
+
+    /*!
+     * Returns the rank bands. A player is in a band if their final rank is not
+     * greater than the band. The default bands are 1, 3 and 10.
+     */
+    [[nodiscard]] QList<int> bands() const;
+    void setBands(const QList<int> &bands);
+
+    /*!
+     * Starts \a simulations simulations of the remaining rounds of \a tournament.
+     *
+     * Any running forecast is cancelled first.
+     */
+    void start(Tournament *tournament, int simulations);
+
+    /*!
+     * Cancels the running forecast. The results computed so far are kept.
+     */
+    void cancel();
+
+    [[nodiscard]] bool isRunning() const;
+
+    [[nodiscard]] int completedSimulations() const;
+    [[nodiscard]] int totalSimulations() const;
+
+    /*!
+     * Returns the forecast of each player, indexed by starting rank minus one.
+     */
+    [[nodiscard]] QList<PlayerForecast> results() const;
+
+Q_SIGNALS:
+    /*!
+     * Emitted when new simulations have been completed.
+     */
+    void progress();
+
+    void finished();
+
+private:
+    struct Run;
+
+    void wait();
+
+    QList<int> m_bands = {1, 3, 10};
+    std::shared_ptr<Run> m_run;
+    QThreadPool m_pool;
+    QList<QFuture<void>> m_workers;
+};
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "generator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "player.h"
+
+TournamentGenerator::TournamentGenerator(const Options &options)
+    : m_options(options)
+    , m_random(options.seed)
+{
+}
+
+QCoro::Task<std::expected<void, QString>> TournamentGenerator::generate(Tournament *tournament)
+{
+    Q_ASSERT(tournament->numberOfPlayers() == 0);
+    Q_ASSERT(m_options.players >= 2 && m_options.rounds >= 1);
+
+    tournament->setName(u"Generated Tournament"_s);
+    tournament->setNumberOfRounds(m_options.rounds);
+    tournament->setPairingSystem(m_options.pairingSystem);
+
+    std::vector<int> ratings(m_options.players);
+    std::ranges::generate(ratings, [this]() {
+        return randomRating();
+    });
+    std::ranges::sort(ratings, std::greater{});
+
+    for (int i = 0; i < m_options.players; ++i) {
+        auto player = std::make_unique<Player>(i + 1, u"Player %1"_s.arg(i + 1), ratings[i]);
+        if (const auto ok = tournament->addPlayer(std::move(player)); !ok) {
+            co_return std::unexpected(ok.error());
+        }
+    }
+
+    std::bernoulli_distribution bye{m_options.byeProbability};
+    std::bernoulli_distribution forfeit{m_options.forfeitProbability};
+
+    for (int round = 1; round <= m_options.rounds; ++round) {
+        const auto players = tournament->players();
+        for (const auto &player : players) {
+            // Round-robins are paired in advance and do not have requested byes
+            if (!tournament->isRoundRobin() && bye(m_random)) {
+                if (const auto ok = tournament->setBye(player, round, Pairing::PartialResult::HalfBye); !ok) {
+                    co_return std::unexpected(ok.error());
+                }
+            }
+        }
+
+        if (const auto ok = co_await tournament->pairNextRound(); !ok) {
+            co_return std::unexpected(ok.error());
+        }
+
+        const auto pairings = tournament->pairings(round);
+        for (const auto &pairing : pairings) {
+            if (pairing->blackPlayer() == nullptr) {
+                continue;
+            }
+
+            Pairing::Result result;
+            if (forfeit(m_random)) {
+                result = m_random.bounded(2) == 0 ? Pairing::Result{Pairing::PartialResult::WinForfeit, Pairing::PartialResult::LostForfeit}
+                                                  : Pairing::Result{Pairing::PartialResult::LostForfeit, Pairing::PartialResult::WinForfeit};
+            } else {
+                result = simulateGame(pairing->whitePlayer()->rating(), pairing->blackPlayer()->rating());
+            }
+
+            if (const auto ok = tournament->setResult(pairing, result); !ok) {
+                co_return std::unexpected(ok.error());
+            }
+        }
+    }
+
+    co_return {};
+}
+
+Pairing::Result TournamentGenerator::simulateGame(int whiteRating, int blackRating)
+{
+    return sampleResult(whiteRating, blackRating, m_options.drawRate, m_random.generateDouble());
+}
+
+Pairing::Result TournamentGenerator::sampleResult(int whiteRating, int blackRating, double drawRate, double value)
+{
+    const auto expected = 1.0 / (1.0 + std::pow(10.0, (blackRating - whiteRating) / 400.0));
+
+    // Draws are most likely between equally rated players
+    const auto draw = drawRate * 2.0 * std::min(expected, 1.0 - expected);
+    const auto win = expected - draw / 2.0;
+
+    if (value < win) {
+        return {Pairing::PartialResult::Win, Pairing::PartialResult::Lost};
+    }
+    if (value < win + draw) {
+        return {Pairing::PartialResult::Draw, Pairing::PartialResult::Draw};
+    }
+    return {Pairing::PartialResult::Lost, Pairing::PartialResult::Win};
+}
+
+int TournamentGenerator::randomRating()
+{
+    double rating;
+
+    switch (m_options.ratingDistribution) {
+    case RatingDistribution::Normal:
+        rating = std::normal_distribution<double>{m_options.ratingMean, m_options.ratingDeviation}(m_random);
+        break;
+    case RatingDistribution::Uniform:
+        rating = std::uniform_real_distribution<double>{static_cast<double>(m_options.minRating), static_cast<double>(m_options.maxRating)}(m_random);
+        break;
+    }
+
+    return std::clamp(static_cast<int>(std::lround(rating)), m_options.minRating, m_options.maxRating);
+}
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QCoroTask>
+#include <QRandomGenerator>
+#include <QString>
+
+#include <expected>
+
+#include "pairing.h"
+#include "tournament.h"
+
+/*!
+ * \class TournamentGenerator
+ * \inmodule tournament
+ * \inheaderfile tournament/generator.h
+ *
+ * \brief Generates random tournaments for testing and benchmarking.
+ *
+ * Rounds are paired with Tournament::pairNextRound(), so generated tournaments go
+ * through the same pairing path as real ones. Results are drawn from the Elo
+ * expected score of each game.
+ */
+class TournamentGenerator
+{
+public:
+    /*!
+     * \enum TournamentGenerator::RatingDistribution
+     *
+     * \value Normal Ratings follow a normal distribution.
+     * \value Uniform Ratings are uniformly distributed between the minimum and the maximum.
+     */
+    enum class RatingDistribution {
+        Normal,
+        Uniform,
+    };
+
+    /*!
+     * \class TournamentGenerator::Options
+     * \inmodule tournament
+     *
+     * \brief Parameters of the generated tournament.
+     */
+    struct Options {
+        int players = 100;
+        int rounds = 9;
+        Tournament::PairingSystem pairingSystem = Tournament::PairingSystem::Dutch;
+
+        RatingDistribution ratingDistribution = RatingDistribution::Normal;
+        double ratingMean = 1800;
+        double ratingDeviation = 250;
+        int minRating = 1000;
+        int maxRating = 2850;
+
+        /*!
+         * Fraction of games between equally rated players that end in a draw.
+         */
+        double drawRate = 0.3;
+
+        /*!
+         * Probability that a player requests a half-point bye in a round.
+         */
+        double byeProbability = 0.02;
+
+        /*!
+         * Probability that a game is lost by forfeit.
+         */
+        double forfeitProbability = 0.01;
+
+        /*!
+         * Seed of the random generator. The same seed generates the same tournament.
+         */
+        quint64 seed = 1;
+    };
+
+    explicit TournamentGenerator(const Options &options = {});
+
+    /*!
+     * Fills the empty \a tournament with players and plays all its rounds.
+     */
+    QCoro::Task<std::expected<void, QString>> generate(Tournament *tournament);
+
+    /*!
+     * Returns the result of a game between players rated \a whiteRating and \a blackRating.
+     */
+    Pairing::Result simulateGame(int whiteRating, int blackRating);
+
+    /*!
+     * Returns the result of a game between players rated \a whiteRating and
+     * \a blackRating, given a uniformly distributed \a value in [0, 1).
+     *
+     * \a drawRate is the fraction of draws between equally rated players.
+     */
+    static Pairing::Result sampleResult(int whiteRating, int blackRating, double drawRate, double value);
+
+private:
+    int randomRating();
+
+    Options m_options;
+    QRandomGenerator m_random;
+};
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "incrementalstandings.h"
+
+#include <QSet>
+
+#include <algorithm>
+#include <iterator>
+
+#include "pairing.h"
+#include "state.h"
+#include "tournament.h"
+
+IncrementalStandings::IncrementalStandings(QObject *parent)
+    : QObject(parent)
+{
+}
+
+IncrementalStandings::~IncrementalStandings() = default;
+
+void IncrementalStandings::setTournament(Tournament *tournament)
+{
+    if (m_tournament != nullptr) {
+        disconnect(m_tournament, nullptr, this, nullptr);
+    }
+
+    invalidate();
+    m_tournament = tournament;
+
+    if (m_tournament != nullptr) {
+        connect(m_tournament, &Tournament::resultChanged, this, &IncrementalStandings::updateResult);
+
+        // Ratings and starting ranks are used by the tiebreaks and to sort the standings
+        connect(m_tournament, &Tournament::numberOfRatedPlayersChanged, this, &IncrementalStandings::invalidate);
+        connect(m_tournament, &Tournament::numberOfPlayersChanged, this, &IncrementalStandings::invalidate);
+    }
+}
+
+void IncrementalStandings::setStandings(int maxRound, const QList<Standing> &standings)
+{
+    Q_ASSERT(m_tournament != nullptr);
+
+    m_maxRound = maxRound;
+    m_valid = true;
+    m_tiebreaks = m_tournament->tiebreaks().compiled();
+    m_tiebreaksJson = m_tournament->tiebreaks().toJson();
+    m_standings = standings;
+
+    m_depth = 0;
+    for (const auto &tiebreak : m_tiebreaks) {
+        const auto depth = tiebreak->dependencyDepth();
+        if (!depth) {
+            m_depth = -1;
+            break;
+        }
+        m_depth = std::max(m_depth, *depth);
+    }
+}
+
+bool IncrementalStandings::isValid() const
+{
+    return m_valid;
+}
+
+int IncrementalStandings::maxRound() const
+{
+    return m_maxRound;
+}
+
+QList<Standing> IncrementalStandings::standings() const
+{
+    return m_standings;
+}
+
+void IncrementalStandings::invalidate()
+{
+    if (!isValid()) {
+        return;
+    }
+
+    m_valid = false;
+    m_tiebreaks.clear();
+    m_standings.clear();
+
+    Q_EMIT invalidated();
+}
+
+bool IncrementalStandings::updateResult(Pairing *pairing)
+{
+    if (!isValid()) {
+        return false;
+    }
+
+    if (m_depth < 0 || m_tournament->tiebreaks().toJson() != m_tiebreaksJson) {
+        invalidate();
+        return false;
+    }
+
+    // A view of the tournament state, which already has the new result
+    const auto state = m_tournament->state(m_maxRound);
+
+    // Results of rounds after the standings don't change them
+    if (!state.round(pairing)) {
+        return true;
+    }
+
+    // Players whose tiebreaks may have changed
+    QSet<int> affected{State::index(pairing->whitePlayer())};
+    if (pairing->blackPlayer() != nullptr) {
+        affected << State::index(pairing->blackPlayer());
+    }
+
+    auto frontier = affected.values();
+    for (int depth = 0; depth < m_depth && !frontier.isEmpty(); ++depth) {
+        QList<int> next;
+        for (const auto player : std::as_const(frontier)) {
+            for (int round = 0; round < state.lastRound(); ++round) {
+                const auto opponent = state.opponent(player, round);
+                if (opponent >= 0 && !affected.contains(opponent)) {
+                    affected << opponent;
+                    next << opponent;
+                }
+            }
+        }
+        frontier = std::move(next);
+    }
+
+    QList<Standing> updated;
+    updated.reserve(affected.size());
+    for (const auto player : std::as_const(affected)) {
+        updated << Standing(state.player(player), values(state, state.player(player)));
+    }
+    std::ranges::sort(updated, Standing::isBefore);
+
+    m_standings.removeIf([&affected](const Standing &standing) {
+        return affected.contains(State::index(standing.player()));
+    });
+
+    QList<Standing> standings;
+    standings.reserve(m_standings.size() + updated.size());
+    std::ranges::merge(m_standings, updated, std::back_inserter(standings), Standing::isBefore);
+    m_standings = std::move(standings);
+
+    for (int i = 0; i < m_standings.size(); ++i) {
+        auto &standing = m_standings[i];
+        if (i > 0 && standing.key() == m_standings.at(i - 1).key()) {
+            standing.setRank(m_standings.at(i - 1).rank());
+        } else {
+            standing.setRank(i + 1);
+        }
+    }
+
+    Q_EMIT standingsChanged();
+
+    return true;
+}
+
+std::vector<double> IncrementalStandings::values(const State &state, Player *player) const
+{
+    std::vector<double> values;
+    values.reserve(m_tiebreaks.size());
+
+    for (const auto &tiebreak : m_tiebreaks) {
+        values.push_back(tiebreak->calculate(m_tournament, state, {}, player));
+    }
+
+    return values;
+}
+
+#include "moc_incrementalstandings.cpp"
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QJsonObject>
+#include <QList>
+#include <QObject>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "standing.h"
+
+class Pairing;
+class Player;
+class State;
+class Tiebreak;
+class Tournament;
+
+/*!
+ * \class IncrementalStandings
+ * \inmodule tournament
+ * \inheaderfile tournament/incrementalstandings.h
+ *
+ * \brief Keeps the standings of a tournament up to date as results are entered.
+ *
+ * The standings are seeded with the result of Tournament::standings(). After that,
+ * every result change only recomputes the tiebreaks of the players it can affect:
+ * the two players of the game and, for tiebreaks depending on the results of the
+ * opponents, the players around them in the graph of opponents. The affected
+ * players are then moved to their new place in the sorted standings.
+ *
+ * When a tiebreak can't be updated incrementally, or the tournament changes in any
+ * other way, like a player being edited, the standings become invalid and have to
+ * be seeded again.
+ */
+class IncrementalStandings : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit IncrementalStandings(QObject *parent = nullptr);
+    ~IncrementalStandings() override;
+
+    /*!
+     * Sets the \a tournament whose standings are kept, and invalidates them.
+     */
+    void setTournament(Tournament *tournament);
+
+    /*!
+     * Seeds the standings after \a maxRound with \a standings, computed by
+     * Tournament::standings().
+     */
+    void setStandings(int maxRound, const QList<Standing> &standings);
+
+    /*!
+     * Returns whether the standings are up to date.
+     */
+    [[nodiscard]] bool isValid() const;
+
+    /*!
+     * Returns the round the standings are computed after.
+     */
+    [[nodiscard]] int maxRound() const;
+
+    /*!
+     * Returns the current standings.
+     */
+    [[nodiscard]] QList<Standing> standings() const;
+
+    /*!
+     * Discards the standings.
+     */
+    void invalidate();
+
+    /*!
+     * Updates the standings after the result of \a pairing changed.
+     *
+     * Returns false if the standings could not be updated and are now invalid.
+     */
+    bool updateResult(Pairing *pairing);
+
+Q_SIGNALS:
+    void standingsChanged();
+    void invalidated();
+
+private:
+    [[nodiscard]] std::vector<double> values(const State &state, Player *player) const;
+
+    Tournament *m_tournament = nullptr;
+    int m_maxRound = 0;
+    bool m_valid = false;
+
+    std::vector<std::shared_ptr<Tiebreak>> m_tiebreaks;
+    QJsonObject m_tiebreaksJson;
+    int m_depth = 0;
+
+    QList<Standing> m_standings;
+};
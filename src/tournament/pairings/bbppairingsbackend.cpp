@@ -1,23 +1,52 @@
 // SPDX-FileCopyrightText: 2024 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
 // SPDX-License-Identifier: GPL-3.0-or-later
 
-#include "pairingengine.h"
+#include "bbppairingsbackend.h"
 
 #include <KLocalizedString>
 #include <QCoreApplication>
+#include <QCoroProcess>
+#include <QElapsedTimer>
 #include <QOperatingSystemVersion>
 #include <QProcess>
 #include <QStandardPaths>
 #include <QTemporaryFile>
 #include <chrono>
-#include <iostream>
 
 #include "trf/writer.h"
 
 using namespace std::literals::chrono_literals;
 
-QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> PairingEngine::pair(int round, Tournament *tournament)
+BbpPairingsBackend::BbpPairingsBackend(Tournament::PairingSystem system)
+    : m_system(system)
 {
+}
+
+QString BbpPairingsBackend::name() const
+{
+    return u"bbpPairings"_s;
+}
+
+QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> BbpPairingsBackend::pair(Tournament *tournament, int round)
+{
+    m_statistics = {};
+
+    QString systemArgument;
+    switch (m_system) {
+    case Tournament::PairingSystem::Dutch:
+        systemArgument = u"--dutch"_s;
+        break;
+    case Tournament::PairingSystem::Burstein:
+        systemArgument = u"--burstein"_s;
+        break;
+    case Tournament::PairingSystem::Dubov:
+    case Tournament::PairingSystem::Lim:
+    case Tournament::PairingSystem::RoundRobin:
+    case Tournament::PairingSystem::DoubleRoundRobin:
+        co_return std::unexpected(i18nc("bbpPairings is the name of a program, should not be translated",
+                                        "bbpPairings does not support the selected pairing system."));
+    }
+
     auto path = QStandardPaths::findExecutable(u"bbpPairings"_s);
     if constexpr (QOperatingSystemVersion::currentType() == QOperatingSystemVersion::Windows) {
         if (path.isEmpty()) {
@@ -51,11 +80,14 @@ QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> PairingEngine:
     file.write(trf.toUtf8());
     file.flush();
 
-    std::cout << trf.toStdString();
+    QElapsedTimer timer;
+    timer.start();
 
-    co_await proc.start(u"bbpPairings"_s, {u"--dutch"_s, file.fileName(), u"-p"_s});
+    co_await proc.start(path, {systemArgument, file.fileName(), u"-p"_s});
     co_await proc.waitForFinished(std::chrono::milliseconds(3s));
 
+    m_statistics.elapsed = std::chrono::microseconds(timer.nsecsElapsed() / 1000);
+
     switch (process.exitCode()) {
     case 0:
         // All good
@@ -72,7 +104,6 @@ QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> PairingEngine:
     const auto players = tournament->playersByStartingRank();
 
     const auto output = QString::fromUtf8(process.readAll());
-    std::cout << output.toStdString();
     const auto lines = output.split(u'\n').mid(1);
 
     for (const auto &line : lines) {
@@ -108,5 +139,3 @@ QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> PairingEngine:
 
     co_return pairings;
 }
-
-#include "moc_pairingengine.cpp"
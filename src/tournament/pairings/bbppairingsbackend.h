@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2024 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "pairingbackend.h"
+
+/*!
+ * \class BbpPairingsBackend
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/bbppairingsbackend.h
+ *
+ * \brief Pairing backend running the external bbpPairings program.
+ *
+ * bbpPairings only implements the Dutch and Burstein systems.
+ */
+class BbpPairingsBackend : public PairingBackend
+{
+public:
+    explicit BbpPairingsBackend(Tournament::PairingSystem system = Tournament::PairingSystem::Dutch);
+
+    [[nodiscard]] QString name() const override;
+
+    QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> pair(Tournament *tournament, int round) override;
+
+private:
+    Tournament::PairingSystem m_system;
+};
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "builtinbackend.h"
+
+#include <KLocalizedString>
+#include <QCoroFuture>
+#include <QElapsedTimer>
+#include <QtConcurrentRun>
+
+#include "pairingsnapshot.h"
+
+BuiltInPairingBackend::BuiltInPairingBackend(Tournament::PairingSystem system)
+    : m_system(system)
+{
+}
+
+QString BuiltInPairingBackend::name() const
+{
+    return u"built-in"_s;
+}
+
+SwissPairingEngine::System BuiltInPairingBackend::engineSystem(Tournament::PairingSystem system)
+{
+    switch (system) {
+    case Tournament::PairingSystem::Dutch:
+        return SwissPairingEngine::System::Dutch;
+    case Tournament::PairingSystem::Burstein:
+        return SwissPairingEngine::System::Burstein;
+    case Tournament::PairingSystem::Dubov:
+        return SwissPairingEngine::System::Dubov;
+    case Tournament::PairingSystem::Lim:
+        return SwissPairingEngine::System::Lim;
+    case Tournament::PairingSystem::RoundRobin:
+    case Tournament::PairingSystem::DoubleRoundRobin:
+        break;
+    }
+    Q_UNREACHABLE();
+}
+
+QList<std::pair<uint, uint>> BuiltInPairingBackend::toStartingRanks(const SwissPairingEngine::Pairs &pairs)
+{
+    QList<std::pair<uint, uint>> pairings;
+    pairings.reserve(static_cast<qsizetype>(pairs.size()));
+    for (const auto &[white, black] : pairs) {
+        pairings << std::pair{static_cast<uint>(white + 1), black < 0 ? 0U : static_cast<uint>(black + 1)};
+    }
+
+    return pairings;
+}
+
+QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> BuiltInPairingBackend::pair(Tournament *tournament, int round)
+{
+    m_statistics = {};
+
+    // The snapshot reads the tournament, so it has to be built in this thread
+    auto snapshot = PairingSnapshot::fromTournament(tournament, round);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const auto [pairs, solvedMatchings] = co_await QtConcurrent::run([system = engineSystem(m_system), snapshot = std::move(snapshot)]() {
+        SwissPairingEngine engine{system};
+        auto pairs = engine.pair(snapshot);
+        return std::pair{std::move(pairs), engine.solvedMatchings()};
+    });
+
+    m_statistics.elapsed = std::chrono::microseconds(timer.nsecsElapsed() / 1000);
+    m_statistics.solvedMatchings = solvedMatchings;
+
+    if (!pairs) {
+        co_return std::unexpected(i18nc("@info", "No valid pairing exists."));
+    }
+
+    co_return toStartingRanks(*pairs);
+}
@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "pairingbackend.h"
+#include "swiss.h"
+
+/*!
+ * \class BuiltInPairingBackend
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/builtinbackend.h
+ *
+ * \brief Pairing backend using the in-process SwissPairingEngine.
+ *
+ * The pairings are computed in a worker thread.
+ */
+class BuiltInPairingBackend : public PairingBackend
+{
+public:
+    explicit BuiltInPairingBackend(Tournament::PairingSystem system);
+
+    [[nodiscard]] QString name() const override;
+
+    QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> pair(Tournament *tournament, int round) override;
+
+    /*!
+     * Returns the SwissPairingEngine system implementing the pairing \a system.
+     */
+    static SwissPairingEngine::System engineSystem(Tournament::PairingSystem system);
+
+    /*!
+     * Converts the \a pairs returned by SwissPairingEngine to pairs of starting ranks.
+     */
+    static QList<std::pair<uint, uint>> toStartingRanks(const SwissPairingEngine::Pairs &pairs);
+
+private:
+    Tournament::PairingSystem m_system;
+};
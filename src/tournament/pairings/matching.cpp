@@ -0,0 +1,981 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "matching.h"
+
+#include <QtGlobal>
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+
+namespace
+{
+// Index into the children of a blossom, allowing negative positions counted from the end
+int wrap(int index, std::size_t size)
+{
+    const auto n = static_cast<int>(size);
+    return ((index % n) + n) % n;
+}
+
+// Weights are doubled inside the algorithm, so the duals start even whatever the
+// edges they come from, and the slacks halved by the algorithm stay even
+template<typename Weight>
+Weight twice(const Weight &weight)
+{
+    return weight + weight;
+}
+
+bool isEven(std::int64_t weight)
+{
+    return weight % 2 == 0;
+}
+
+std::int64_t half(std::int64_t weight)
+{
+    return weight / 2;
+}
+
+bool isEven(const LexicographicWeight &weight)
+{
+    return weight.isEven();
+}
+
+LexicographicWeight half(const LexicographicWeight &weight)
+{
+    return weight.half();
+}
+
+std::int64_t roundUpToEven(std::int64_t weight)
+{
+    return isEven(weight) ? weight : weight + 1;
+}
+
+LexicographicWeight roundUpToEven(LexicographicWeight weight)
+{
+    for (std::size_t c = 0; c < LexicographicWeight::Size; ++c) {
+        weight[c] = roundUpToEven(weight[c]);
+    }
+    return weight;
+}
+}
+
+template<typename Weight>
+BasicMatchingGraph<Weight>::BasicMatchingGraph(int vertices)
+    : m_vertices(vertices)
+{
+}
+
+template<typename Weight>
+void BasicMatchingGraph<Weight>::reset(int vertices)
+{
+    m_vertices = vertices;
+    m_from.clear();
+    m_to.clear();
+    m_weights.clear();
+    m_offsets.clear();
+    m_adjacency.clear();
+}
+
+template<typename Weight>
+void BasicMatchingGraph<Weight>::reserve(int vertices, std::size_t edges)
+{
+    m_from.reserve(edges);
+    m_to.reserve(edges);
+    m_weights.reserve(edges);
+    m_offsets.reserve(vertices + 1);
+    m_adjacency.reserve(2 * edges);
+}
+
+template<typename Weight>
+void BasicMatchingGraph<Weight>::addEdge(int u, int v, const Weight &weight)
+{
+    Q_ASSERT(u != v);
+    Q_ASSERT(u >= 0 && u < m_vertices);
+    Q_ASSERT(v >= 0 && v < m_vertices);
+
+    m_from.push_back(u);
+    m_to.push_back(v);
+    m_weights.push_back(weight);
+}
+
+template<typename Weight>
+void BasicMatchingGraph<Weight>::build()
+{
+    m_offsets.assign(m_vertices + 1, 0);
+    for (std::size_t k = 0; k < m_from.size(); ++k) {
+        ++m_offsets[m_from[k] + 1];
+        ++m_offsets[m_to[k] + 1];
+    }
+    std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+
+    m_adjacency.resize(2 * m_from.size());
+    std::vector<int> position(m_offsets.begin(), m_offsets.end() - 1);
+    for (std::size_t k = 0; k < m_from.size(); ++k) {
+        const auto edge = static_cast<int>(k);
+        m_adjacency[position[m_from[k]]++] = 2 * edge + 1;
+        m_adjacency[position[m_to[k]]++] = 2 * edge;
+    }
+}
+
+template<typename Weight>
+int BasicMatchingGraph<Weight>::vertexCount() const
+{
+    return m_vertices;
+}
+
+template<typename Weight>
+std::size_t BasicMatchingGraph<Weight>::edgeCount() const
+{
+    return m_from.size();
+}
+
+template<typename Weight>
+int BasicMatchingGraph<Weight>::edgeFrom(std::size_t edge) const
+{
+    return m_from[edge];
+}
+
+template<typename Weight>
+int BasicMatchingGraph<Weight>::edgeTo(std::size_t edge) const
+{
+    return m_to[edge];
+}
+
+template<typename Weight>
+const Weight &BasicMatchingGraph<Weight>::edgeWeight(std::size_t edge) const
+{
+    return m_weights[edge];
+}
+
+template<typename Weight>
+std::span<const int> BasicMatchingGraph<Weight>::endpoints(int vertex) const
+{
+    Q_ASSERT(m_offsets.size() == static_cast<std::size_t>(m_vertices) + 1);
+
+    return std::span<const int>{m_adjacency}.subspan(m_offsets[vertex], m_offsets[vertex + 1] - m_offsets[vertex]);
+}
+
+template<typename Weight>
+int BasicMatchingGraph<Weight>::endpointVertex(int endpoint) const
+{
+    return (endpoint & 1) ? m_to[endpoint / 2] : m_from[endpoint / 2];
+}
+
+template<typename Weight>
+const std::vector<int> &BasicMaximumWeightMatching<Weight>::solve(const Graph &graph, bool maximumCardinality)
+{
+    return run(graph, maximumCardinality, false);
+}
+
+template<typename Weight>
+const std::vector<int> &BasicMaximumWeightMatching<Weight>::resolve(const Graph &graph)
+{
+    const int n = graph.vertexCount();
+    if (!m_resolvable || n != m_vertices) {
+        return run(graph, false, false);
+    }
+
+    // The duals of the blossoms are moved to their vertices, so the duals stay
+    // feasible without the blossoms
+    m_previousDual.assign(m_dual.begin(), m_dual.begin() + n);
+    for (int v = 0; v < n; ++v) {
+        for (int b = m_blossomParent[v]; b != -1; b = m_blossomParent[b]) {
+            m_previousDual[v] += m_dual[b];
+        }
+    }
+    m_previousMate = m_result;
+
+    return run(graph, false, true);
+}
+
+template<typename Weight>
+const std::vector<int> &BasicMaximumWeightMatching<Weight>::run(const Graph &graph, bool maximumCardinality, bool warm)
+{
+    const int n = graph.vertexCount();
+    const auto edges = graph.edgeCount();
+
+    m_graph = &graph;
+    m_vertices = n;
+    m_size = 0;
+    m_result.assign(n, -1);
+    m_resolvable = false;
+
+    if (n == 0 || edges == 0) {
+        return m_result;
+    }
+
+    m_mate.assign(n, -1);
+    m_label.assign(2 * n, 0);
+    m_labelEnd.assign(2 * n, -1);
+    m_inBlossom.resize(n);
+    std::iota(m_inBlossom.begin(), m_inBlossom.end(), 0);
+    m_blossomParent.assign(2 * n, -1);
+    m_blossomChildren.resize(2 * n);
+    m_blossomEndpoints.resize(2 * n);
+    m_blossomBestEdges.resize(2 * n);
+    for (int b = 0; b < 2 * n; ++b) {
+        m_blossomChildren[b].clear();
+        m_blossomEndpoints[b].clear();
+        m_blossomBestEdges[b].clear();
+    }
+    m_hasBlossomBestEdges.assign(2 * n, false);
+    m_blossomBase.resize(2 * n);
+    std::iota(m_blossomBase.begin(), m_blossomBase.begin() + n, 0);
+    std::fill(m_blossomBase.begin() + n, m_blossomBase.end(), -1);
+    m_bestEdge.assign(2 * n, -1);
+    m_unusedBlossoms.resize(n);
+    std::iota(m_unusedBlossoms.begin(), m_unusedBlossoms.end(), n);
+    m_dual.assign(2 * n, Weight{});
+    m_allowEdge.assign(edges, false);
+    m_queue.clear();
+    m_queue.reserve(n);
+
+    if (warm) {
+        // The previous duals are raised where they are no longer feasible, and the
+        // previous pairs that are still tight are kept
+        std::copy(m_previousDual.begin(), m_previousDual.end(), m_dual.begin());
+        for (std::size_t k = 0; k < edges; ++k) {
+            const auto edgeSlack = slack(static_cast<int>(k));
+            if (edgeSlack < Weight{}) {
+                m_dual[graph.edgeFrom(k)] -= edgeSlack;
+            }
+        }
+        for (int v = 0; v < n; ++v) {
+            const int mate = m_previousMate[v];
+            if (mate < v) {
+                continue;
+            }
+            for (const int p : graph.endpoints(v)) {
+                if (graph.endpointVertex(p) == mate) {
+                    if (slack(p / 2) == Weight{}) {
+                        m_mate[v] = p;
+                        m_mate[mate] = p ^ 1;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    if (maximumCardinality) {
+        // Start with a greedy matching of edges of maximum weight, which are tight
+        // with the initial duals
+        Weight maxWeight{};
+        for (std::size_t k = 0; k < edges; ++k) {
+            maxWeight = std::max(maxWeight, graph.edgeWeight(k));
+        }
+        std::fill(m_dual.begin(), m_dual.begin() + n, twice(maxWeight));
+        for (int v = 0; v < n; ++v) {
+            if (m_mate[v] != -1) {
+                continue;
+            }
+            for (const int p : graph.endpoints(v)) {
+                const int w = graph.endpointVertex(p);
+                if (m_mate[w] == -1 && graph.edgeWeight(p / 2) == maxWeight) {
+                    m_mate[v] = p;
+                    m_mate[w] = p ^ 1;
+                    break;
+                }
+            }
+        }
+    } else {
+        initializeDuals();
+    }
+
+    // Each stage finds an augmenting path, or a vertex that can be left unmatched
+    bool finished = false;
+    while (!finished) {
+        std::fill(m_label.begin(), m_label.end(), 0);
+        std::fill(m_bestEdge.begin(), m_bestEdge.end(), -1);
+        for (int b = n; b < 2 * n; ++b) {
+            m_blossomBestEdges[b].clear();
+            m_hasBlossomBestEdges[b] = false;
+        }
+        std::fill(m_allowEdge.begin(), m_allowEdge.end(), false);
+        m_queue.clear();
+
+        // Unmatched vertices with a zero dual are already optimal
+        bool roots = false;
+        for (int v = 0; v < n; ++v) {
+            if (m_mate[v] == -1 && m_label[m_inBlossom[v]] == 0 && (maximumCardinality || Weight{} < m_dual[v])) {
+                assignLabel(v, 1, -1);
+                roots = true;
+            }
+        }
+        if (!roots) {
+            break;
+        }
+
+        bool augmented = false;
+        while (true) {
+            while (!m_queue.empty() && !augmented) {
+                const int v = m_queue.back();
+                m_queue.pop_back();
+                Q_ASSERT(m_label[m_inBlossom[v]] == 1);
+
+                for (const int p : graph.endpoints(v)) {
+                    const int k = p / 2;
+                    const int w = graph.endpointVertex(p);
+
+                    if (m_inBlossom[v] == m_inBlossom[w]) {
+                        continue;
+                    }
+
+                    if (!m_allowEdge[k] && isTight(k)) {
+                        m_allowEdge[k] = true;
+                    }
+
+                    if (m_allowEdge[k]) {
+                        if (m_label[m_inBlossom[w]] == 0 && m_mate[m_blossomBase[m_inBlossom[w]]] == -1) {
+                            // An unmatched vertex with a zero dual ends an
+                            // augmenting path
+                            assignLabel(w, 1, -1);
+                            augmentMatching(k);
+                            augmented = true;
+                            break;
+                        } else if (m_label[m_inBlossom[w]] == 0) {
+                            assignLabel(w, 2, p ^ 1);
+                        } else if (m_label[m_inBlossom[w]] == 1) {
+                            const int base = scanBlossom(v, w);
+                            if (base >= 0) {
+                                addBlossom(base, k);
+                            } else {
+                                augmentMatching(k);
+                                augmented = true;
+                                break;
+                            }
+                        } else if (m_label[w] == 0) {
+                            m_label[w] = 2;
+                            m_labelEnd[w] = p ^ 1;
+                        }
+                    } else if (m_label[m_inBlossom[w]] == 1) {
+                        const int b = m_inBlossom[v];
+                        if (m_bestEdge[b] == -1 || hasSmallerSlack(k, m_bestEdge[b])) {
+                            m_bestEdge[b] = k;
+                        }
+                    } else if (m_label[w] == 0) {
+                        if (m_bestEdge[w] == -1 || hasSmallerSlack(k, m_bestEdge[w])) {
+                            m_bestEdge[w] = k;
+                        }
+                    }
+                }
+            }
+
+            if (augmented) {
+                break;
+            }
+
+            // No augmenting path with the current duals: update them
+            int deltaType = -1;
+            Weight delta{};
+            int deltaVertex = -1;
+            int deltaEdge = -1;
+            int deltaBlossom = -1;
+
+            if (!maximumCardinality) {
+                for (int v = 0; v < n; ++v) {
+                    if (m_label[m_inBlossom[v]] == 1 && (deltaType == -1 || m_dual[v] < delta)) {
+                        delta = m_dual[v];
+                        deltaType = 1;
+                        deltaVertex = v;
+                    }
+                }
+            }
+
+            for (int v = 0; v < n; ++v) {
+                if (m_label[m_inBlossom[v]] == 0 && m_bestEdge[v] != -1) {
+                    const auto d = slack(m_bestEdge[v]);
+                    if (deltaType == -1 || d < delta) {
+                        delta = d;
+                        deltaType = 2;
+                        deltaEdge = m_bestEdge[v];
+                    }
+                }
+            }
+
+            for (int b = 0; b < 2 * n; ++b) {
+                if (m_blossomParent[b] == -1 && m_label[b] == 1 && m_bestEdge[b] != -1) {
+                    const auto kslack = slack(m_bestEdge[b]);
+                    Q_ASSERT(isEven(kslack));
+                    const auto d = half(kslack);
+                    if (deltaType == -1 || d < delta) {
+                        delta = d;
+                        deltaType = 3;
+                        deltaEdge = m_bestEdge[b];
+                    }
+                }
+            }
+
+            for (int b = n; b < 2 * n; ++b) {
+                if (m_blossomBase[b] >= 0 && m_blossomParent[b] == -1 && m_label[b] == 2 && (deltaType == -1 || m_dual[b] < delta)) {
+                    delta = m_dual[b];
+                    deltaType = 4;
+                    deltaBlossom = b;
+                }
+            }
+
+            if (deltaType == -1) {
+                // No further improvement possible, but the duals are still updated
+                // to reach optimality.
+                Q_ASSERT(maximumCardinality);
+                deltaType = 1;
+                delta = std::max(Weight{}, *std::min_element(m_dual.begin(), m_dual.begin() + n));
+            }
+
+            for (int v = 0; v < n; ++v) {
+                const auto label = m_label[m_inBlossom[v]];
+                if (label == 1) {
+                    m_dual[v] -= delta;
+                } else if (label == 2) {
+                    m_dual[v] += delta;
+                }
+            }
+            for (int b = n; b < 2 * n; ++b) {
+                if (m_blossomBase[b] >= 0 && m_blossomParent[b] == -1) {
+                    if (m_label[b] == 1) {
+                        m_dual[b] += delta;
+                    } else if (m_label[b] == 2) {
+                        m_dual[b] -= delta;
+                    }
+                }
+            }
+
+            if (deltaType == 1) {
+                if (maximumCardinality) {
+                    finished = true;
+                } else {
+                    // The vertex doesn't need to be matched with a zero dual, so
+                    // the path from its root is flipped to leave it unmatched
+                    augmentPath(deltaVertex, -1);
+                }
+                break;
+            } else if (deltaType == 2) {
+                m_allowEdge[deltaEdge] = true;
+                int i = graph.edgeFrom(deltaEdge);
+                int j = graph.edgeTo(deltaEdge);
+                if (m_label[m_inBlossom[i]] == 0) {
+                    std::swap(i, j);
+                }
+                Q_ASSERT(m_label[m_inBlossom[i]] == 1);
+                m_queue.push_back(i);
+            } else if (deltaType == 3) {
+                m_allowEdge[deltaEdge] = true;
+                const int i = graph.edgeFrom(deltaEdge);
+                Q_ASSERT(m_label[m_inBlossom[i]] == 1);
+                m_queue.push_back(i);
+            } else {
+                expandBlossom(deltaBlossom, false);
+            }
+        }
+
+        if (finished) {
+            break;
+        }
+
+        // Expand the S-blossoms with zero dual at the end of the stage
+        for (int b = n; b < 2 * n; ++b) {
+            if (m_blossomParent[b] == -1 && m_blossomBase[b] >= 0 && m_label[b] == 1 && m_dual[b] == Weight{}) {
+                expandBlossom(b, true);
+            }
+        }
+    }
+
+    for (int v = 0; v < n; ++v) {
+        if (m_mate[v] >= 0) {
+            m_result[v] = graph.endpointVertex(m_mate[v]);
+            ++m_size;
+        }
+    }
+    m_size /= 2;
+    m_resolvable = !maximumCardinality;
+
+    return m_result;
+}
+
+template<typename Weight>
+void BasicMaximumWeightMatching<Weight>::initializeDuals()
+{
+    const auto &graph = *m_graph;
+    const int n = m_vertices;
+
+    // The dual of every unmatched vertex is set to its best edge to another
+    // unmatched vertex, or higher if its matched neighbours require it. The edges
+    // that are the best ones of both of their vertices are then tight and can be
+    // matched greedily, and this is repeated for the vertices left unmatched.
+    // Duals can't be negative, and the vertices with a zero dual can be left
+    // unmatched.
+    //
+    // The duals of the unmatched vertices must be even, so the slacks between
+    // them are even too. The duals of matched vertices kept by resolve() may not
+    // be.
+    bool matched = true;
+    while (matched) {
+        matched = false;
+        for (int v = 0; v < n; ++v) {
+            if (m_mate[v] != -1) {
+                continue;
+            }
+            Weight dual{};
+            for (const int p : graph.endpoints(v)) {
+                const int w = graph.endpointVertex(p);
+                const auto weight = twice(graph.edgeWeight(p / 2));
+                dual = std::max(dual, m_mate[w] == -1 ? weight : twice(weight) - m_dual[w]);
+            }
+            m_dual[v] = roundUpToEven(dual);
+        }
+
+        for (int v = 0; v < n; ++v) {
+            if (m_mate[v] != -1 || m_dual[v] == Weight{}) {
+                continue;
+            }
+            for (const int p : graph.endpoints(v)) {
+                const int w = graph.endpointVertex(p);
+                if (m_mate[w] == -1 && slack(p / 2) == Weight{}) {
+                    m_mate[v] = p;
+                    m_mate[w] = p ^ 1;
+                    matched = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+template<typename Weight>
+int BasicMaximumWeightMatching<Weight>::size() const
+{
+    return m_size;
+}
+
+template<typename Weight>
+Weight BasicMaximumWeightMatching<Weight>::slack(int edge) const
+{
+    const auto &weight = m_graph->edgeWeight(edge);
+    return m_dual[m_graph->edgeFrom(edge)] + m_dual[m_graph->edgeTo(edge)] - twice(twice(weight));
+}
+
+// The slacks of lexicographic weights are compared component by component, which
+// usually stops at the first one
+template<typename Weight>
+bool BasicMaximumWeightMatching<Weight>::isTight(int edge) const
+{
+    if constexpr (std::is_integral_v<Weight>) {
+        return slack(edge) <= 0;
+    } else {
+        const auto &weight = m_graph->edgeWeight(edge);
+        const auto &a = m_dual[m_graph->edgeFrom(edge)];
+        const auto &b = m_dual[m_graph->edgeTo(edge)];
+        for (std::size_t c = 0; c < Weight::Size; ++c) {
+            const auto s = a[c] + b[c] - 4 * weight[c];
+            if (s != 0) {
+                return s < 0;
+            }
+        }
+        return true;
+    }
+}
+
+template<typename Weight>
+bool BasicMaximumWeightMatching<Weight>::hasSmallerSlack(int edge, int other) const
+{
+    if constexpr (std::is_integral_v<Weight>) {
+        return slack(edge) < slack(other);
+    } else {
+        const auto &weight = m_graph->edgeWeight(edge);
+        const auto &a = m_dual[m_graph->edgeFrom(edge)];
+        const auto &b = m_dual[m_graph->edgeTo(edge)];
+        const auto &otherWeight = m_graph->edgeWeight(other);
+        const auto &c = m_dual[m_graph->edgeFrom(other)];
+        const auto &d = m_dual[m_graph->edgeTo(other)];
+        for (std::size_t i = 0; i < Weight::Size; ++i) {
+            const auto s = a[i] + b[i] - 4 * weight[i];
+            const auto t = c[i] + d[i] - 4 * otherWeight[i];
+            if (s != t) {
+                return s < t;
+            }
+        }
+        return false;
+    }
+}
+
+template<typename Weight>
+void BasicMaximumWeightMatching<Weight>::blossomLeaves(int blossom, std::vector<int> &leaves) const
+{
+    if (blossom < m_vertices) {
+        leaves.push_back(blossom);
+        return;
+    }
+    for (const int child : m_blossomChildren[blossom]) {
+        blossomLeaves(child, leaves);
+    }
+}
+
+template<typename Weight>
+void BasicMaximumWeightMatching<Weight>::assignLabel(int w, int t, int p)
+{
+    const int b = m_inBlossom[w];
+    Q_ASSERT(m_label[w] == 0 && m_label[b] == 0);
+
+    m_label[w] = m_label[b] = t;
+    m_labelEnd[w] = m_labelEnd[b] = p;
+    m_bestEdge[w] = m_bestEdge[b] = -1;
+
+    if (t == 1) {
+        blossomLeaves(b, m_queue);
+    } else if (t == 2) {
+        const int base = m_blossomBase[b];
+        Q_ASSERT(m_mate[base] >= 0);
+        assignLabel(m_graph->endpointVertex(m_mate[base]), 1, m_mate[base] ^ 1);
+    }
+}
+
+template<typename Weight>
+int BasicMaximumWeightMatching<Weight>::scanBlossom(int v, int w)
+{
+    // Trace back from v and w, marking the blossoms on the way, until a common
+    // base is found or both paths reach a single vertex.
+    std::vector<int> path;
+    int base = -1;
+
+    while (v != -1 || w != -1) {
+        int b = m_inBlossom[v];
+        if (m_label[b] & 4) {
+            base = m_blossomBase[b];
+            break;
+        }
+        Q_ASSERT(m_label[b] == 1);
+        path.push_back(b);
+        m_label[b] = 5;
+
+        if (m_labelEnd[b] == -1) {
+            v = -1;
+        } else {
+            v = m_graph->endpointVertex(m_labelEnd[b]);
+            b = m_inBlossom[v];
+            Q_ASSERT(m_label[b] == 2);
+            Q_ASSERT(m_labelEnd[b] >= 0);
+            v = m_graph->endpointVertex(m_labelEnd[b]);
+        }
+
+        if (w != -1) {
+            std::swap(v, w);
+        }
+    }
+
+    for (const int b : path) {
+        m_label[b] = 1;
+    }
+
+    return base;
+}
+
+template<typename Weight>
+void BasicMaximumWeightMatching<Weight>::addBlossom(int base, int edge)
+{
+    int v = m_graph->edgeFrom(edge);
+    int w = m_graph->edgeTo(edge);
+    const int bb = m_inBlossom[base];
+    int bv = m_inBlossom[v];
+    int bw = m_inBlossom[w];
+
+    const int b = m_unusedBlossoms.back();
+    m_unusedBlossoms.pop_back();
+
+    m_blossomBase[b] = base;
+    m_blossomParent[b] = -1;
+    m_blossomParent[bb] = b;
+
+    auto &path = m_blossomChildren[b];
+    auto &endpoints = m_blossomEndpoints[b];
+    path.clear();
+    endpoints.clear();
+
+    while (bv != bb) {
+        m_blossomParent[bv] = b;
+        path.push_back(bv);
+        endpoints.push_back(m_labelEnd[bv]);
+        Q_ASSERT(m_labelEnd[bv] >= 0);
+        v = m_graph->endpointVertex(m_labelEnd[bv]);
+        bv = m_inBlossom[v];
+    }
+    path.push_back(bb);
+    std::ranges::reverse(path);
+    std::ranges::reverse(endpoints);
+    endpoints.push_back(2 * edge);
+
+    while (bw != bb) {
+        m_blossomParent[bw] = b;
+        path.push_back(bw);
+        endpoints.push_back(m_labelEnd[bw] ^ 1);
+        Q_ASSERT(m_labelEnd[bw] >= 0);
+        w = m_graph->endpointVertex(m_labelEnd[bw]);
+        bw = m_inBlossom[w];
+    }
+
+    Q_ASSERT(m_label[bb] == 1);
+    m_label[b] = 1;
+    m_labelEnd[b] = m_labelEnd[bb];
+    m_dual[b] = Weight{};
+
+    m_leaves.clear();
+    blossomLeaves(b, m_leaves);
+    for (const int leaf : m_leaves) {
+        if (m_label[m_inBlossom[leaf]] == 2) {
+            // T-vertices inside the new blossom become S-vertices
+            m_queue.push_back(leaf);
+        }
+        m_inBlossom[leaf] = b;
+    }
+
+    // Compute the least-slack edges to the neighbouring S-blossoms
+    m_bestEdgeTo.assign(2 * m_vertices, -1);
+    const auto consider = [this, b](int k) {
+        int i = m_graph->edgeFrom(k);
+        int j = m_graph->edgeTo(k);
+        if (m_inBlossom[j] == b) {
+            std::swap(i, j);
+        }
+        const int bj = m_inBlossom[j];
+        if (bj != b && m_label[bj] == 1 && (m_bestEdgeTo[bj] == -1 || hasSmallerSlack(k, m_bestEdgeTo[bj]))) {
+            m_bestEdgeTo[bj] = k;
+        }
+    };
+
+    for (const int child : path) {
+        if (!m_hasBlossomBestEdges[child]) {
+            m_leaves.clear();
+            blossomLeaves(child, m_leaves);
+            for (const int leaf : m_leaves) {
+                for (const int p : m_graph->endpoints(leaf)) {
+                    consider(p / 2);
+                }
+            }
+        } else {
+            for (const int k : m_blossomBestEdges[child]) {
+                consider(k);
+            }
+        }
+        m_blossomBestEdges[child].clear();
+        m_hasBlossomBestEdges[child] = false;
+        m_bestEdge[child] = -1;
+    }
+
+    auto &bestEdges = m_blossomBestEdges[b];
+    bestEdges.clear();
+    for (const int k : m_bestEdgeTo) {
+        if (k != -1) {
+            bestEdges.push_back(k);
+        }
+    }
+    m_hasBlossomBestEdges[b] = true;
+
+    m_bestEdge[b] = -1;
+    for (const int k : bestEdges) {
+        if (m_bestEdge[b] == -1 || hasSmallerSlack(k, m_bestEdge[b])) {
+            m_bestEdge[b] = k;
+        }
+    }
+}
+
+template<typename Weight>
+void BasicMaximumWeightMatching<Weight>::expandBlossom(int blossom, bool endStage)
+{
+    const int b = blossom;
+    std::vector<int> leaves;
+
+    // Convert the sub-blossoms into top-level blossoms
+    for (std::size_t c = 0; c < m_blossomChildren[b].size(); ++c) {
+        const int s = m_blossomChildren[b][c];
+        m_blossomParent[s] = -1;
+        if (s < m_vertices) {
+            m_inBlossom[s] = s;
+        } else if (endStage && m_dual[s] == Weight{}) {
+            expandBlossom(s, endStage);
+        } else {
+            leaves.clear();
+            blossomLeaves(s, leaves);
+            for (const int leaf : leaves) {
+                m_inBlossom[leaf] = s;
+            }
+        }
+    }
+
+    if (!endStage && m_label[b] == 2) {
+        // Relabel the sub-blossoms on the even side of the path through the blossom
+        const auto &children = m_blossomChildren[b];
+        const auto &endpoints = m_blossomEndpoints[b];
+        const auto size = children.size();
+
+        Q_ASSERT(m_labelEnd[b] >= 0);
+        const int entryChild = m_inBlossom[m_graph->endpointVertex(m_labelEnd[b] ^ 1)];
+
+        int j = static_cast<int>(std::ranges::find(children, entryChild) - children.begin());
+        int jStep;
+        int endpointTrick;
+        if (j & 1) {
+            j -= static_cast<int>(size);
+            jStep = 1;
+            endpointTrick = 0;
+        } else {
+            jStep = -1;
+            endpointTrick = 1;
+        }
+
+        int p = m_labelEnd[b];
+        while (j != 0) {
+            m_label[m_graph->endpointVertex(p ^ 1)] = 0;
+            m_label[m_graph->endpointVertex(endpoints[wrap(j - endpointTrick, size)] ^ endpointTrick ^ 1)] = 0;
+            assignLabel(m_graph->endpointVertex(p ^ 1), 2, p);
+            m_allowEdge[endpoints[wrap(j - endpointTrick, size)] / 2] = true;
+            j += jStep;
+            p = endpoints[wrap(j - endpointTrick, size)] ^ endpointTrick;
+            m_allowEdge[p / 2] = true;
+            j += jStep;
+        }
+
+        int bv = children[wrap(j, size)];
+        m_label[m_graph->endpointVertex(p ^ 1)] = m_label[bv] = 2;
+        m_labelEnd[m_graph->endpointVertex(p ^ 1)] = m_labelEnd[bv] = p;
+        m_bestEdge[bv] = -1;
+
+        j += jStep;
+        while (children[wrap(j, size)] != entryChild) {
+            bv = children[wrap(j, size)];
+            if (m_label[bv] == 1) {
+                j += jStep;
+                continue;
+            }
+
+            leaves.clear();
+            blossomLeaves(bv, leaves);
+            int v = -1;
+            for (const int leaf : leaves) {
+                v = leaf;
+                if (m_label[leaf] != 0) {
+                    break;
+                }
+            }
+
+            if (v != -1 && m_label[v] != 0) {
+                Q_ASSERT(m_label[v] == 2);
+                Q_ASSERT(m_inBlossom[v] == bv);
+                m_label[v] = 0;
+                m_label[m_graph->endpointVertex(m_mate[m_blossomBase[bv]])] = 0;
+                assignLabel(v, 2, m_labelEnd[v]);
+            }
+            j += jStep;
+        }
+    }
+
+    m_label[b] = -1;
+    m_labelEnd[b] = -1;
+    m_blossomChildren[b].clear();
+    m_blossomEndpoints[b].clear();
+    m_blossomBase[b] = -1;
+    m_blossomBestEdges[b].clear();
+    m_hasBlossomBestEdges[b] = false;
+    m_bestEdge[b] = -1;
+    m_unusedBlossoms.push_back(b);
+}
+
+template<typename Weight>
+void BasicMaximumWeightMatching<Weight>::augmentBlossom(int blossom, int v)
+{
+    const int b = blossom;
+
+    // Find the sub-blossom of b containing v
+    int t = v;
+    while (m_blossomParent[t] != b) {
+        t = m_blossomParent[t];
+    }
+    if (t >= m_vertices) {
+        augmentBlossom(t, v);
+    }
+
+    auto &children = m_blossomChildren[b];
+    auto &endpoints = m_blossomEndpoints[b];
+    const auto size = children.size();
+
+    const int i = static_cast<int>(std::ranges::find(children, t) - children.begin());
+    int j = i;
+    int jStep;
+    int endpointTrick;
+    if (i & 1) {
+        j -= static_cast<int>(size);
+        jStep = 1;
+        endpointTrick = 0;
+    } else {
+        jStep = -1;
+        endpointTrick = 1;
+    }
+
+    while (j != 0) {
+        j += jStep;
+        t = children[wrap(j, size)];
+        const int p = endpoints[wrap(j - endpointTrick, size)] ^ endpointTrick;
+        if (t >= m_vertices) {
+            augmentBlossom(t, m_graph->endpointVertex(p));
+        }
+        j += jStep;
+        t = children[wrap(j, size)];
+        if (t >= m_vertices) {
+            augmentBlossom(t, m_graph->endpointVertex(p ^ 1));
+        }
+        m_mate[m_graph->endpointVertex(p)] = p ^ 1;
+        m_mate[m_graph->endpointVertex(p ^ 1)] = p;
+    }
+
+    // Rotate the blossom so that the new base is the first child
+    std::rotate(children.begin(), children.begin() + i, children.end());
+    std::rotate(endpoints.begin(), endpoints.begin() + i, endpoints.end());
+    m_blossomBase[b] = m_blossomBase[children.front()];
+    Q_ASSERT(m_blossomBase[b] == v);
+}
+
+template<typename Weight>
+void BasicMaximumWeightMatching<Weight>::augmentMatching(int edge)
+{
+    const std::pair<int, int> sides[] = {{m_graph->edgeFrom(edge), 2 * edge + 1}, {m_graph->edgeTo(edge), 2 * edge}};
+
+    for (const auto &[s, p] : sides) {
+        augmentPath(s, p);
+    }
+}
+
+template<typename Weight>
+void BasicMaximumWeightMatching<Weight>::augmentPath(int s, int p)
+{
+    while (true) {
+        const int bs = m_inBlossom[s];
+        Q_ASSERT(m_label[bs] == 1);
+        if (bs >= m_vertices) {
+            augmentBlossom(bs, s);
+        }
+        m_mate[s] = p;
+
+        if (m_labelEnd[bs] == -1) {
+            // Reached a single vertex: the path is complete
+            break;
+        }
+
+        const int t = m_graph->endpointVertex(m_labelEnd[bs]);
+        const int bt = m_inBlossom[t];
+        Q_ASSERT(m_label[bt] == 2);
+        Q_ASSERT(m_labelEnd[bt] >= 0);
+        s = m_graph->endpointVertex(m_labelEnd[bt]);
+        const int j = m_graph->endpointVertex(m_labelEnd[bt] ^ 1);
+        Q_ASSERT(m_blossomBase[bt] == t);
+        if (bt >= m_vertices) {
+            augmentBlossom(bt, j);
+        }
+        m_mate[j] = m_labelEnd[bt];
+        p = m_labelEnd[bt] ^ 1;
+    }
+}
+
+template class BasicMatchingGraph<std::int64_t>;
+template class BasicMaximumWeightMatching<std::int64_t>;
+
+template class BasicMatchingGraph<LexicographicWeight>;
+template class BasicMaximumWeightMatching<LexicographicWeight>;
@@ -0,0 +1,273 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/*!
+ * \class LexicographicWeight
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/matching.h
+ *
+ * \brief Edge weight made of several integer components, compared in
+ * lexicographic order.
+ *
+ * It is used when a matching has to optimize several criteria by priority: the
+ * first component is the most important one, and the next ones only break the ties
+ * of the previous ones. Components are added independently, so they never carry
+ * over to each other.
+ */
+class LexicographicWeight
+{
+public:
+    static constexpr std::size_t Size = 16;
+
+    constexpr LexicographicWeight() = default;
+
+    std::int64_t &operator[](std::size_t component)
+    {
+        return m_components[component];
+    }
+
+    std::int64_t operator[](std::size_t component) const
+    {
+        return m_components[component];
+    }
+
+    LexicographicWeight &operator+=(const LexicographicWeight &other)
+    {
+        for (std::size_t i = 0; i < Size; ++i) {
+            m_components[i] += other.m_components[i];
+        }
+        return *this;
+    }
+
+    LexicographicWeight &operator-=(const LexicographicWeight &other)
+    {
+        for (std::size_t i = 0; i < Size; ++i) {
+            m_components[i] -= other.m_components[i];
+        }
+        return *this;
+    }
+
+    friend LexicographicWeight operator+(LexicographicWeight a, const LexicographicWeight &b)
+    {
+        return a += b;
+    }
+
+    friend LexicographicWeight operator-(LexicographicWeight a, const LexicographicWeight &b)
+    {
+        return a -= b;
+    }
+
+    friend bool operator==(const LexicographicWeight &a, const LexicographicWeight &b) = default;
+    friend auto operator<=>(const LexicographicWeight &a, const LexicographicWeight &b) = default;
+
+    /*!
+     * Returns whether all the components are even.
+     */
+    [[nodiscard]] bool isEven() const
+    {
+        for (const auto component : m_components) {
+            if (component % 2 != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * Returns the weight with every component divided by two.
+     */
+    [[nodiscard]] LexicographicWeight half() const
+    {
+        LexicographicWeight result;
+        for (std::size_t i = 0; i < Size; ++i) {
+            result.m_components[i] = m_components[i] / 2;
+        }
+        return result;
+    }
+
+private:
+    std::array<std::int64_t, Size> m_components{};
+};
+
+/*!
+ * \class BasicMatchingGraph
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/matching.h
+ *
+ * \brief Undirected weighted graph stored in compressed sparse row (CSR) form.
+ *
+ * Vertices are consecutive integers, usually the starting rank of the players minus
+ * one. Edges are stored in contiguous arrays, and the adjacency of every vertex is a
+ * contiguous range of edge endpoints, built by build() after adding all the edges.
+ *
+ * Weights are usually integers (MatchingGraph), or LexicographicWeight when several
+ * criteria are optimized at once (LexicographicMatchingGraph).
+ */
+template<typename Weight>
+class BasicMatchingGraph
+{
+public:
+    explicit BasicMatchingGraph(int vertices = 0);
+
+    /*!
+     * Removes all the edges and sets the number of vertices to \a vertices, keeping
+     * the allocated memory.
+     */
+    void reset(int vertices);
+
+    /*!
+     * Reserves memory for \a vertices vertices and \a edges edges.
+     */
+    void reserve(int vertices, std::size_t edges);
+
+    /*!
+     * Adds an edge between \a u and \a v with weight \a weight.
+     *
+     * Edges must be added before calling build().
+     */
+    void addEdge(int u, int v, const Weight &weight);
+
+    /*!
+     * Builds the adjacency arrays.
+     */
+    void build();
+
+    [[nodiscard]] int vertexCount() const;
+    [[nodiscard]] std::size_t edgeCount() const;
+
+    [[nodiscard]] int edgeFrom(std::size_t edge) const;
+    [[nodiscard]] int edgeTo(std::size_t edge) const;
+    [[nodiscard]] const Weight &edgeWeight(std::size_t edge) const;
+
+    /*!
+     * Returns the endpoints adjacent to \a vertex.
+     *
+     * Endpoint 2k is the first vertex of edge k, and endpoint 2k + 1 the second one.
+     * The endpoints returned are the ones at the other side of the edges.
+     */
+    [[nodiscard]] std::span<const int> endpoints(int vertex) const;
+
+    /*!
+     * Returns the vertex of \a endpoint.
+     */
+    [[nodiscard]] int endpointVertex(int endpoint) const;
+
+private:
+    int m_vertices = 0;
+
+    std::vector<int> m_from;
+    std::vector<int> m_to;
+    std::vector<Weight> m_weights;
+
+    std::vector<int> m_offsets;
+    std::vector<int> m_adjacency;
+};
+
+/*!
+ * \class BasicMaximumWeightMatching
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/matching.h
+ *
+ * \brief Maximum weight matching in general graphs.
+ *
+ * Implementation of Edmonds' blossom algorithm with dual variables, running in
+ * O(n³) time. Weights are integers, or vectors of integers, so all the
+ * computations are exact.
+ *
+ * The working memory is kept between calls to solve(), so the same object can be
+ * used to solve many graphs of similar size without allocating memory. When the
+ * graphs only differ in a few edges, resolve() also reuses the previous solution.
+ */
+template<typename Weight>
+class BasicMaximumWeightMatching
+{
+public:
+    using Graph = BasicMatchingGraph<Weight>;
+
+    explicit BasicMaximumWeightMatching() = default;
+
+    /*!
+     * Computes a maximum weight matching of \a graph.
+     *
+     * If \a maximumCardinality is true, only matchings with the maximum number of
+     * edges are considered.
+     *
+     * Returns, for every vertex, the vertex it is matched with, or -1 if it is not
+     * matched.
+     */
+    const std::vector<int> &solve(const Graph &graph, bool maximumCardinality = false);
+
+    /*!
+     * Computes a maximum weight matching of \a graph, starting from the matching
+     * and the dual variables of the last graph solved.
+     *
+     * The result is the same as solve() without \c maximumCardinality, but it is
+     * found much faster when \a graph has the same vertices as the last graph and
+     * only a few of its edges changed, for example when some edges are removed or
+     * their weights are lowered.
+     */
+    const std::vector<int> &resolve(const Graph &graph);
+
+    /*!
+     * Returns the number of edges of the last matching computed.
+     */
+    [[nodiscard]] int size() const;
+
+private:
+    const std::vector<int> &run(const Graph &graph, bool maximumCardinality, bool warm);
+    Weight slack(int edge) const;
+    bool isTight(int edge) const;
+    bool hasSmallerSlack(int edge, int other) const;
+    void blossomLeaves(int blossom, std::vector<int> &leaves) const;
+    void assignLabel(int w, int t, int p);
+    int scanBlossom(int v, int w);
+    void addBlossom(int base, int edge);
+    void expandBlossom(int blossom, bool endStage);
+    void augmentBlossom(int blossom, int v);
+    void augmentMatching(int edge);
+    void augmentPath(int s, int p);
+    void initializeDuals();
+
+    const Graph *m_graph = nullptr;
+    int m_vertices = 0;
+
+    std::vector<int> m_mate;
+    std::vector<int> m_label;
+    std::vector<int> m_labelEnd;
+    std::vector<int> m_inBlossom;
+    std::vector<int> m_blossomParent;
+    std::vector<std::vector<int>> m_blossomChildren;
+    std::vector<int> m_blossomBase;
+    std::vector<std::vector<int>> m_blossomEndpoints;
+    std::vector<int> m_bestEdge;
+    std::vector<std::vector<int>> m_blossomBestEdges;
+    std::vector<char> m_hasBlossomBestEdges;
+    std::vector<int> m_unusedBlossoms;
+    std::vector<Weight> m_dual;
+    std::vector<char> m_allowEdge;
+    std::vector<int> m_queue;
+
+    std::vector<int> m_leaves;
+    std::vector<int> m_bestEdgeTo;
+    std::vector<int> m_result;
+    int m_size = 0;
+
+    // Starting point of resolve()
+    bool m_resolvable = false;
+    std::vector<Weight> m_previousDual;
+    std::vector<int> m_previousMate;
+};
+
+using MatchingGraph = BasicMatchingGraph<std::int64_t>;
+using MaximumWeightMatching = BasicMaximumWeightMatching<std::int64_t>;
+
+using LexicographicMatchingGraph = BasicMatchingGraph<LexicographicWeight>;
+using LexicographicMatching = BasicMaximumWeightMatching<LexicographicWeight>;
@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "pairingbackend.h"
+
+#include "bbppairingsbackend.h"
+#include "builtinbackend.h"
+#include "roundrobin.h"
+
+std::unique_ptr<PairingBackend> PairingBackend::create(Tournament::PairingSystem system, Tournament::PairingEngine engine)
+{
+    // The Berger tables do not need a pairing engine
+    if (system == Tournament::PairingSystem::RoundRobin || system == Tournament::PairingSystem::DoubleRoundRobin) {
+        return std::make_unique<RoundRobinPairingBackend>(system == Tournament::PairingSystem::DoubleRoundRobin);
+    }
+
+    switch (engine) {
+    case Tournament::PairingEngine::BuiltIn:
+        return std::make_unique<BuiltInPairingBackend>(system);
+    case Tournament::PairingEngine::BbpPairings:
+        return std::make_unique<BbpPairingsBackend>(system);
+    }
+    Q_UNREACHABLE();
+}
+
+PairingBackend::Statistics PairingBackend::statistics() const
+{
+    return m_statistics;
+}
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QCoroTask>
+#include <QList>
+#include <QString>
+
+#include <chrono>
+#include <expected>
+#include <memory>
+#include <optional>
+
+#include "tournament.h"
+
+/*!
+ * \class PairingBackend
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/pairingbackend.h
+ *
+ * \brief Interface of the implementations of the pairing systems.
+ *
+ * A backend computes the pairings of a round, either in-process or by running an
+ * external program, and reports statistics about the last pairing.
+ */
+class PairingBackend
+{
+public:
+    /*!
+     * \class PairingBackend::Statistics
+     * \inmodule tournament
+     *
+     * \brief Statistics about the last pairing computed by a backend.
+     */
+    struct Statistics {
+        /*!
+         * Time spent computing the pairings.
+         */
+        std::chrono::microseconds elapsed{0};
+
+        /*!
+         * Number of matchings solved to find the pairings, if the backend reports
+         * it.
+         */
+        std::optional<long long> solvedMatchings;
+    };
+
+    virtual ~PairingBackend() = default;
+
+    /*!
+     * Returns the backend for the pairing \a system using the pairing \a engine.
+     */
+    static std::unique_ptr<PairingBackend> create(Tournament::PairingSystem system, Tournament::PairingEngine engine);
+
+    /*!
+     * Returns a human readable name of the backend, used in logs.
+     */
+    [[nodiscard]] virtual QString name() const = 0;
+
+    /*!
+     * Returns the pairings for \a round of \a tournament as pairs of starting ranks
+     * (white, black).
+     *
+     * The player receiving the pairing-allocated bye is paired with 0.
+     */
+    virtual QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> pair(Tournament *tournament, int round) = 0;
+
+    /*!
+     * Returns the statistics of the last call to pair().
+     */
+    [[nodiscard]] Statistics statistics() const;
+
+protected:
+    Statistics m_statistics;
+};
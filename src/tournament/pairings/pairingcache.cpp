@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "pairingcache.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QIODevice>
+
+#include <utility>
+
+#include "db.h"
+#include "pairingsnapshot.h"
+#include "statementcache.h"
+
+PairingCache::PairingCache(StatementCache &statements, const QString &tournament)
+    : m_statements(statements)
+    , m_tournament(tournament)
+{
+}
+
+QByteArray PairingCache::key(const PairingSnapshot &snapshot, Tournament::PairingSystem system, Tournament::PairingEngine engine)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(snapshot.hash());
+    hash.addData(QByteArray::number(std::to_underlying(system)));
+    hash.addData(QByteArray::number(std::to_underlying(engine)));
+    hash.addData(QByteArray::number(EngineVersion));
+
+    return hash.result();
+}
+
+std::expected<std::optional<PairingCache::Pairings>, QString> PairingCache::find(const QByteArray &key)
+{
+    Pairings pairings;
+    {
+        auto query = m_statements.statement(GET_CACHED_PAIRINGS_QUERY);
+        if (!query) {
+            return std::unexpected(query.error());
+        }
+
+        query->bindValue(u":tournament"_s, m_tournament);
+        query->bindValue(u":key"_s, key);
+
+        if (!query->exec()) {
+            return std::unexpected(query->lastError().text());
+        }
+
+        if (!query->query().next()) {
+            return std::nullopt;
+        }
+
+        QDataStream stream(query->query().value(0).toByteArray());
+        stream >> pairings;
+
+        if (stream.status() != QDataStream::Ok) {
+            return std::nullopt;
+        }
+    }
+
+    auto query = m_statements.statement(TOUCH_CACHED_PAIRINGS_QUERY);
+    if (!query) {
+        return std::unexpected(query.error());
+    }
+
+    query->bindValue(u":tournament"_s, m_tournament);
+    query->bindValue(u":key"_s, key);
+    query->bindValue(u":lastUsed"_s, QDateTime::currentMSecsSinceEpoch());
+
+    if (!query->exec()) {
+        return std::unexpected(query->lastError().text());
+    }
+
+    return pairings;
+}
+
+std::expected<void, QString> PairingCache::insert(const QByteArray &key, int round, const Pairings &pairings)
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream << pairings;
+
+    auto query = m_statements.statement(ADD_CACHED_PAIRINGS_QUERY);
+    if (!query) {
+        return std::unexpected(query.error());
+    }
+
+    query->bindValue(u":tournament"_s, m_tournament);
+    query->bindValue(u":key"_s, key);
+    query->bindValue(u":round"_s, round);
+    query->bindValue(u":pairings"_s, data);
+    query->bindValue(u":lastUsed"_s, QDateTime::currentMSecsSinceEpoch());
+
+    if (!query->exec()) {
+        return std::unexpected(query->lastError().text());
+    }
+
+    auto prune = m_statements.statement(PRUNE_CACHED_PAIRINGS_QUERY);
+    if (!prune) {
+        return std::unexpected(prune.error());
+    }
+
+    prune->bindValue(u":tournament"_s, m_tournament);
+    prune->bindValue(u":round"_s, round);
+    prune->bindValue(u":limit"_s, EntriesPerRound);
+
+    if (!prune->exec()) {
+        return std::unexpected(prune->lastError().text());
+    }
+
+    return {};
+}
+
+std::expected<void, QString> PairingCache::clear()
+{
+    auto query = m_statements.statement(CLEAR_CACHED_PAIRINGS_QUERY);
+    if (!query) {
+        return std::unexpected(query.error());
+    }
+
+    query->bindValue(u":tournament"_s, m_tournament);
+
+    if (!query->exec()) {
+        return std::unexpected(query->lastError().text());
+    }
+
+    return {};
+}
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+
+#include <expected>
+#include <optional>
+
+#include "tournament.h"
+
+class PairingSnapshot;
+class StatementCache;
+
+/*!
+ * \class PairingCache
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/pairingcache.h
+ *
+ * \brief Stores computed pairings in the event database.
+ *
+ * Pairings are keyed by a hash of the pairing inputs, so re-pairing a round whose
+ * inputs did not change (for example, after removing its pairings, or after fixing
+ * a result and restoring it) returns the stored pairings without running the
+ * pairing backend again.
+ *
+ * The statements are taken from the StatementCache of the event, so they are only
+ * prepared once.
+ */
+class PairingCache
+{
+public:
+    using Pairings = QList<std::pair<uint, uint>>;
+
+    /*!
+     * Maximum number of cached pairings kept for each round.
+     */
+    static constexpr int EntriesPerRound = 8;
+
+    /*!
+     * Version of the pairing engines, part of every key. It has to be increased
+     * whenever the pairings generated by an engine change, so pairings cached by
+     * older versions are not used again.
+     */
+    static constexpr int EngineVersion = 2;
+
+    explicit PairingCache(StatementCache &statements, const QString &tournament);
+
+    /*!
+     * Returns the cache key of \a snapshot paired with \a system by \a engine, in
+     * the current EngineVersion.
+     */
+    static QByteArray key(const PairingSnapshot &snapshot, Tournament::PairingSystem system, Tournament::PairingEngine engine);
+
+    /*!
+     * Returns the pairings stored with \a key, or std::nullopt if there are none.
+     */
+    std::expected<std::optional<Pairings>, QString> find(const QByteArray &key);
+
+    /*!
+     * Stores the \a pairings of \a round with \a key.
+     *
+     * Only the most recently used entries of each round are kept.
+     */
+    std::expected<void, QString> insert(const QByteArray &key, int round, const Pairings &pairings);
+
+    /*!
+     * Removes all the cached pairings of the tournament.
+     */
+    std::expected<void, QString> clear();
+
+private:
+    StatementCache &m_statements;
+    QString m_tournament;
+};
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "pairingchecker.h"
+
+#include <KLocalizedString>
+#include <QElapsedTimer>
+#include <QSet>
+#include <QtConcurrentMap>
+
+#include <algorithm>
+#include <vector>
+
+#include "builtinbackend.h"
+#include "pairingsnapshot.h"
+#include "roundrobin.h"
+
+namespace
+{
+struct Job {
+    int round;
+    PairingSnapshot snapshot;
+    PairingChecker::Pairings stored;
+};
+}
+
+bool PairingChecker::RoundReport::matches() const
+{
+    return error.isEmpty() && unexpected.isEmpty() && missing.isEmpty();
+}
+
+PairingChecker::PairingChecker(Tournament::PairingSystem system)
+    : m_system(system)
+{
+}
+
+void PairingChecker::setMaxThreads(int maxThreads)
+{
+    m_pool.setMaxThreadCount(std::max(1, maxThreads));
+}
+
+QList<PairingChecker::RoundReport> PairingChecker::check(Tournament *tournament)
+{
+    // The snapshots read the tournament, so they have to be built in this thread
+    std::vector<Job> jobs;
+
+    const bool roundRobin = m_system == Tournament::PairingSystem::RoundRobin || m_system == Tournament::PairingSystem::DoubleRoundRobin;
+    const bool doubleRoundRobin = m_system == Tournament::PairingSystem::DoubleRoundRobin;
+
+    for (int round = 1; round <= tournament->currentRound(); ++round) {
+        const auto pairings = tournament->pairings(round);
+        if (pairings.isEmpty()) {
+            continue;
+        }
+
+        Pairings stored;
+        stored.reserve(pairings.size());
+        for (const auto &pairing : pairings) {
+            if (pairing->blackPlayer() != nullptr) {
+                stored << std::pair{static_cast<uint>(pairing->whitePlayer()->startingRank()), static_cast<uint>(pairing->blackPlayer()->startingRank())};
+            } else if (roundRobin || !Pairing::isVoluntaryBye(pairing->whiteResult())) {
+                stored << std::pair{static_cast<uint>(pairing->whitePlayer()->startingRank()), 0U};
+            }
+        }
+
+        jobs.push_back({round, PairingSnapshot::fromTournament(tournament, round), std::move(stored)});
+    }
+
+    const auto system = roundRobin ? SwissPairingEngine::System::Dutch : BuiltInPairingBackend::engineSystem(m_system);
+
+    return QtConcurrent::blockingMapped<QList<RoundReport>>(&m_pool, jobs, [system, roundRobin, doubleRoundRobin](const Job &job) {
+        RoundReport report;
+        report.round = job.round;
+
+        QElapsedTimer timer;
+        timer.start();
+
+        std::optional<SwissPairingEngine::Pairs> pairs;
+        if (!roundRobin) {
+            SwissPairingEngine engine{system};
+            pairs = engine.pair(job.snapshot);
+        } else if (const auto players = job.snapshot.numberOfPlayers(); job.round <= BergerTables::numberOfRounds(players, doubleRoundRobin)) {
+            pairs = BergerTables::pairings(players, job.round - 1, doubleRoundRobin);
+        }
+
+        report.elapsed = std::chrono::microseconds(timer.nsecsElapsed() / 1000);
+
+        if (!pairs) {
+            report.error = i18nc("@info", "No valid pairing exists.");
+            report.unexpected = job.stored;
+            return report;
+        }
+
+        report.expected = BuiltInPairingBackend::toStartingRanks(*pairs);
+
+        const QSet<std::pair<uint, uint>> expected{report.expected.cbegin(), report.expected.cend()};
+        const QSet<std::pair<uint, uint>> stored{job.stored.cbegin(), job.stored.cend()};
+
+        for (const auto &pairing : job.stored) {
+            if (!expected.contains(pairing)) {
+                report.unexpected << pairing;
+            }
+        }
+        for (const auto &pairing : report.expected) {
+            if (!stored.contains(pairing)) {
+                report.missing << pairing;
+            }
+        }
+
+        return report;
+    });
+}
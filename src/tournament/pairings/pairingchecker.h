@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QList>
+#include <QString>
+#include <QThreadPool>
+
+#include <chrono>
+
+#include "tournament.h"
+
+/*!
+ * \class PairingChecker
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/pairingchecker.h
+ *
+ * \brief Checks the pairings of a tournament against a pairing system.
+ *
+ * Every round is paired again from the state of the tournament after the previous
+ * round, and the result is compared with the stored pairings, like
+ * \c {bbpPairings -c} does. Rounds are independent, so they are checked in
+ * parallel.
+ */
+class PairingChecker
+{
+public:
+    using Pairings = QList<std::pair<uint, uint>>;
+
+    /*!
+     * \class PairingChecker::RoundReport
+     * \inmodule tournament
+     *
+     * \brief Result of checking one round.
+     *
+     * Pairings are pairs of starting ranks (white, black). The player receiving the
+     * pairing-allocated bye is paired with 0. Voluntary byes are not compared.
+     */
+    struct RoundReport {
+        int round = 0;
+
+        /*!
+         * Pairings generated by the pairing system.
+         */
+        Pairings expected;
+
+        /*!
+         * Stored pairings that were not generated by the pairing system.
+         */
+        Pairings unexpected;
+
+        /*!
+         * Generated pairings that are missing from the stored pairings.
+         */
+        Pairings missing;
+
+        /*!
+         * Error message if the round could not be paired.
+         */
+        QString error;
+
+        std::chrono::microseconds elapsed{0};
+
+        /*!
+         * Returns whether the stored pairings match the generated ones.
+         */
+        [[nodiscard]] bool matches() const;
+    };
+
+    explicit PairingChecker(Tournament::PairingSystem system = Tournament::PairingSystem::Dutch);
+
+    /*!
+     * Sets the maximum number of rounds checked at the same time.
+     */
+    void setMaxThreads(int maxThreads);
+
+    /*!
+     * Checks the paired rounds of \a tournament and returns a report for each one.
+     *
+     * Blocks until all the rounds have been checked.
+     */
+    QList<RoundReport> check(Tournament *tournament);
+
+private:
+    Tournament::PairingSystem m_system;
+    QThreadPool m_pool;
+};
@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "pairingsnapshot.h"
+
+#include <QCryptographicHash>
+
+#include "tournament.h"
+
+#include <algorithm>
+
+PairingSnapshot::PairingSnapshot(int numberOfPlayers, int numberOfRounds, Pairing::Color initialColor)
+    : m_numberOfPlayers(numberOfPlayers)
+    , m_numberOfRounds(numberOfRounds)
+    , m_initialColor(initialColor)
+    , m_ratings(numberOfPlayers, 0)
+    , m_available(numberOfPlayers, true)
+{
+    Q_ASSERT(numberOfPlayers >= 0);
+
+    const auto capacity = static_cast<std::size_t>(numberOfPlayers) * std::max(numberOfRounds, 1);
+    m_opponents.reserve(capacity);
+    m_colors.reserve(capacity);
+    m_results.reserve(capacity);
+}
+
+PairingSnapshot PairingSnapshot::fromTournament(Tournament *tournament, int round)
+{
+    Q_ASSERT(round >= 1);
+
+    const auto initialColor = tournament->initialColor() == Tournament::InitialColor::White ? Pairing::Color::White : Pairing::Color::Black;
+
+    PairingSnapshot snapshot{tournament->numberOfPlayers(), std::max(tournament->numberOfRounds(), round), initialColor};
+
+    const auto players = tournament->players();
+    for (const auto &player : players) {
+        snapshot.setRating(player->startingRank() - 1, player->rating());
+    }
+
+    for (int i = 1; i < round; ++i) {
+        const auto r = snapshot.addRound();
+
+        const auto pairings = tournament->pairings(i);
+        for (const auto &pairing : pairings) {
+            const auto white = pairing->whitePlayer()->startingRank() - 1;
+            if (pairing->blackPlayer() == nullptr) {
+                snapshot.setBye(r, white, pairing->whiteResult());
+            } else {
+                const auto black = pairing->blackPlayer()->startingRank() - 1;
+                snapshot.setGame(r, white, black, pairing->whiteResult(), pairing->blackResult());
+            }
+        }
+    }
+
+    // Players with a requested bye in the round to pair are not paired.
+    const auto pairings = tournament->pairings(round);
+    for (const auto &pairing : pairings) {
+        if (pairing->blackPlayer() == nullptr && Pairing::isVoluntaryBye(pairing->whiteResult())) {
+            snapshot.setAvailable(pairing->whitePlayer()->startingRank() - 1, false);
+        }
+    }
+
+    return snapshot;
+}
+
+int PairingSnapshot::numberOfPlayers() const
+{
+    return m_numberOfPlayers;
+}
+
+int PairingSnapshot::numberOfRounds() const
+{
+    return m_numberOfRounds;
+}
+
+int PairingSnapshot::playedRounds() const
+{
+    return m_playedRounds;
+}
+
+Pairing::Color PairingSnapshot::initialColor() const
+{
+    return m_initialColor;
+}
+
+int PairingSnapshot::rating(int player) const
+{
+    return m_ratings[player];
+}
+
+void PairingSnapshot::setRating(int player, int rating)
+{
+    m_ratings[player] = rating;
+}
+
+bool PairingSnapshot::isAvailable(int player) const
+{
+    return m_available[player];
+}
+
+void PairingSnapshot::setAvailable(int player, bool available)
+{
+    m_available[player] = available;
+}
+
+int PairingSnapshot::opponent(int player, int round) const
+{
+    return m_opponents[index(player, round)];
+}
+
+Pairing::Color PairingSnapshot::color(int player, int round) const
+{
+    return m_colors[index(player, round)];
+}
+
+Pairing::PartialResult PairingSnapshot::result(int player, int round) const
+{
+    return m_results[index(player, round)];
+}
+
+bool PairingSnapshot::hasPlayed(int player, int round) const
+{
+    const auto i = index(player, round);
+    return m_opponents[i] >= 0 && !Pairing::isUnplayed(m_results[i]);
+}
+
+double PairingSnapshot::points(int player, int rounds) const
+{
+    Q_ASSERT(rounds <= m_playedRounds);
+
+    double points = 0.;
+    for (int i = 0; i < rounds; ++i) {
+        points += Pairing::pointsForResult(m_results[index(player, i)]);
+    }
+    return points;
+}
+
+double PairingSnapshot::points(int player) const
+{
+    return points(player, m_playedRounds);
+}
+
+int PairingSnapshot::addRound()
+{
+    const auto size = static_cast<std::size_t>(m_numberOfPlayers) * (m_playedRounds + 1);
+    m_opponents.resize(size, -1);
+    m_colors.resize(size, Pairing::Color::Unknown);
+    m_results.resize(size, Pairing::PartialResult::Unknown);
+
+    m_numberOfRounds = std::max(m_numberOfRounds, m_playedRounds + 1);
+
+    return m_playedRounds++;
+}
+
+void PairingSnapshot::setGame(int round, int white, int black, Pairing::PartialResult whiteResult, Pairing::PartialResult blackResult)
+{
+    const auto w = index(white, round);
+    m_opponents[w] = black;
+    m_colors[w] = Pairing::Color::White;
+    m_results[w] = whiteResult;
+
+    const auto b = index(black, round);
+    m_opponents[b] = white;
+    m_colors[b] = Pairing::Color::Black;
+    m_results[b] = blackResult;
+}
+
+void PairingSnapshot::setBye(int round, int player, Pairing::PartialResult result)
+{
+    const auto i = index(player, round);
+    m_opponents[i] = -1;
+    m_colors[i] = Pairing::Color::Unknown;
+    m_results[i] = result;
+}
+
+void PairingSnapshot::setResult(int round, int player, Pairing::PartialResult result)
+{
+    m_results[index(player, round)] = result;
+}
+
+std::size_t PairingSnapshot::memoryUsage() const
+{
+    return sizeof(*this) + m_ratings.capacity() * sizeof(int) + m_available.capacity() * sizeof(char) + m_opponents.capacity() * sizeof(int)
+        + m_colors.capacity() * sizeof(Pairing::Color) + m_results.capacity() * sizeof(Pairing::PartialResult);
+}
+
+QByteArray PairingSnapshot::hash() const
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+
+    const auto addVector = [&hash](const auto &vector) {
+        const auto size = static_cast<qint64>(vector.size());
+        hash.addData(QByteArrayView(reinterpret_cast<const char *>(&size), sizeof(size)));
+        hash.addData(QByteArrayView(reinterpret_cast<const char *>(vector.data()), static_cast<qsizetype>(vector.size() * sizeof(vector[0]))));
+    };
+
+    const std::vector<int> header = {m_numberOfPlayers, m_numberOfRounds, m_playedRounds, std::to_underlying(m_initialColor)};
+    addVector(header);
+    addVector(m_ratings);
+    addVector(m_available);
+    addVector(m_opponents);
+    addVector(m_colors);
+    addVector(m_results);
+
+    return hash.result();
+}
+
+std::size_t PairingSnapshot::index(int player, int round) const
+{
+    Q_ASSERT(player >= 0 && player < m_numberOfPlayers);
+    Q_ASSERT(round >= 0 && round < m_playedRounds);
+
+    return static_cast<std::size_t>(round) * m_numberOfPlayers + player;
+}
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QByteArray>
+
+#include <vector>
+
+#include "pairing.h"
+
+class Tournament;
+
+/*!
+ * \class PairingSnapshot
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/pairingsnapshot.h
+ *
+ * \brief Flat copy of the information needed to pair a round.
+ *
+ * Players are identified by their index, which is their starting rank minus one.
+ * The history is stored round by round, so new rounds can be appended cheaply
+ * when simulating a tournament.
+ */
+class PairingSnapshot
+{
+public:
+    explicit PairingSnapshot() = default;
+
+    explicit PairingSnapshot(int numberOfPlayers, int numberOfRounds, Pairing::Color initialColor = Pairing::Color::White);
+
+    /*!
+     * Returns the snapshot of \a tournament needed to pair the round \a round.
+     *
+     * Rounds before \a round are copied as the history. Players with a requested bye
+     * in \a round are marked as not available.
+     */
+    static PairingSnapshot fromTournament(Tournament *tournament, int round);
+
+    [[nodiscard]] int numberOfPlayers() const;
+
+    /*!
+     * Returns the number of rounds of the tournament.
+     */
+    [[nodiscard]] int numberOfRounds() const;
+
+    /*!
+     * Returns the number of rounds in the history.
+     */
+    [[nodiscard]] int playedRounds() const;
+
+    [[nodiscard]] Pairing::Color initialColor() const;
+
+    [[nodiscard]] int rating(int player) const;
+    void setRating(int player, int rating);
+
+    /*!
+     * Returns whether \a player has to be paired in the next round.
+     */
+    [[nodiscard]] bool isAvailable(int player) const;
+    void setAvailable(int player, bool available);
+
+    /*!
+     * Returns the opponent of \a player in \a round, or -1 if the player had no opponent.
+     *
+     * Rounds are zero based.
+     */
+    [[nodiscard]] int opponent(int player, int round) const;
+    [[nodiscard]] Pairing::Color color(int player, int round) const;
+    [[nodiscard]] Pairing::PartialResult result(int player, int round) const;
+
+    /*!
+     * Returns whether \a player played a game over the board in \a round.
+     */
+    [[nodiscard]] bool hasPlayed(int player, int round) const;
+
+    /*!
+     * Returns the points of \a player after the first \a rounds rounds.
+     */
+    [[nodiscard]] double points(int player, int rounds) const;
+    [[nodiscard]] double points(int player) const;
+
+    /*!
+     * Appends an empty round to the history and returns its index.
+     */
+    int addRound();
+
+    void setGame(int round, int white, int black, Pairing::PartialResult whiteResult, Pairing::PartialResult blackResult);
+    void setBye(int round, int player, Pairing::PartialResult result);
+    void setResult(int round, int player, Pairing::PartialResult result);
+
+    /*!
+     * Returns a SHA-256 hash of the canonical contents of the snapshot.
+     *
+     * Two snapshots have the same hash if and only if (barring collisions) they
+     * contain the same players, ratings, availability, history and initial color,
+     * so they lead to the same pairings.
+     */
+    [[nodiscard]] QByteArray hash() const;
+
+    /*!
+     * Returns the approximate number of bytes used by the snapshot.
+     */
+    [[nodiscard]] std::size_t memoryUsage() const;
+
+private:
+    [[nodiscard]] std::size_t index(int player, int round) const;
+
+    int m_numberOfPlayers = 0;
+    int m_numberOfRounds = 0;
+    int m_playedRounds = 0;
+    Pairing::Color m_initialColor = Pairing::Color::White;
+
+    std::vector<int> m_ratings;
+    std::vector<char> m_available;
+
+    // Round-major: [round * numberOfPlayers + player]
+    std::vector<int> m_opponents;
+    std::vector<Pairing::Color> m_colors;
+    std::vector<Pairing::PartialResult> m_results;
+};
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "roundrobin.h"
+
+#include <KLocalizedString>
+
+#include <optional>
+
+#include "builtinbackend.h"
+
+namespace
+{
+constexpr std::size_t tableSize(int players)
+{
+    return static_cast<std::size_t>(players - 1) * static_cast<std::size_t>(players / 2);
+}
+
+constexpr std::size_t TotalTableSize = [] {
+    std::size_t size = 0;
+    for (int players = 2; players <= BergerTables::MaxTablePlayers; players += 2) {
+        size += tableSize(players);
+    }
+    return size;
+}();
+
+// Berger tables for every even number of players up to MaxTablePlayers, one after
+// the other. Odd numbers of players use the table of the next even number.
+struct Tables {
+    std::array<std::pair<std::int8_t, std::int8_t>, TotalTableSize> pairs{};
+    std::array<std::size_t, BergerTables::MaxTablePlayers / 2 + 1> offsets{};
+};
+
+constexpr Tables tables = [] {
+    Tables tables;
+    std::size_t offset = 0;
+    for (int players = 2; players <= BergerTables::MaxTablePlayers; players += 2) {
+        tables.offsets[players / 2] = offset;
+        for (int round = 0; round < players - 1; ++round) {
+            for (int board = 0; board < players / 2; ++board) {
+                const auto [white, black] = BergerTables::pairing(players, round, board);
+                tables.pairs[offset++] = {static_cast<std::int8_t>(white), static_cast<std::int8_t>(black)};
+            }
+        }
+    }
+    return tables;
+}();
+
+constexpr std::pair<int, int> tablePairing(int players, int round, int board)
+{
+    const auto [white, black] = tables.pairs[tables.offsets[players / 2] + static_cast<std::size_t>(round * (players / 2) + board)];
+    return {white, black};
+}
+
+// FIDE Berger table for 6 players, round 2: 6-4, 5-3, 1-2
+static_assert(tablePairing(6, 1, 0) == std::pair{5, 3});
+static_assert(tablePairing(6, 1, 1) == std::pair{4, 2});
+static_assert(tablePairing(6, 1, 2) == std::pair{0, 1});
+}
+
+BergerTables::Pairs BergerTables::pairings(int players, int round, bool doubleRoundRobin)
+{
+    Q_ASSERT(players >= 2);
+    Q_ASSERT(round >= 0 && round < numberOfRounds(players, doubleRoundRobin));
+
+    const auto even = players + players % 2;
+    const auto cycleRounds = even - 1;
+    const bool reversed = round >= cycleRounds;
+    round %= cycleRounds;
+
+    Pairs pairs;
+    pairs.reserve(even / 2);
+
+    std::optional<int> bye;
+
+    for (int board = 0; board < even / 2; ++board) {
+        auto [white, black] = even <= MaxTablePlayers ? tablePairing(even, round, board) : pairing(even, round, board);
+        if (reversed) {
+            std::swap(white, black);
+        }
+
+        // The dummy player of an odd group
+        if (white >= players) {
+            bye = black;
+        } else if (black >= players) {
+            bye = white;
+        } else {
+            pairs.emplace_back(white, black);
+        }
+    }
+
+    if (bye) {
+        pairs.emplace_back(*bye, -1);
+    }
+
+    return pairs;
+}
+
+RoundRobinPairingBackend::RoundRobinPairingBackend(bool doubleRoundRobin)
+    : m_doubleRoundRobin(doubleRoundRobin)
+{
+}
+
+QString RoundRobinPairingBackend::name() const
+{
+    return m_doubleRoundRobin ? u"double round-robin"_s : u"round-robin"_s;
+}
+
+QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> RoundRobinPairingBackend::pair(Tournament *tournament, int round)
+{
+    m_statistics = {};
+
+    const auto players = tournament->numberOfPlayers();
+
+    if (players < 2) {
+        co_return std::unexpected(i18nc("@info", "A round-robin needs at least two players."));
+    }
+
+    if (round > BergerTables::numberOfRounds(players, m_doubleRoundRobin)) {
+        co_return std::unexpected(i18nc("@info", "All the rounds of the round-robin have already been paired."));
+    }
+
+    co_return BuiltInPairingBackend::toStartingRanks(BergerTables::pairings(players, round - 1, m_doubleRoundRobin));
+}
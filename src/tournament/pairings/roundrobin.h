@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "pairingbackend.h"
+
+/*!
+ * \namespace BergerTables
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/roundrobin.h
+ *
+ * \brief FIDE Berger tables for round-robin tournaments (C.05 Annex 1).
+ *
+ * Players are identified by their index, which is their starting rank minus one.
+ * With an odd number of players, a dummy player is added and the player paired
+ * against it does not play that round.
+ */
+namespace BergerTables
+{
+/*!
+ * Largest number of players with a precomputed table. Larger groups are
+ * generated at runtime.
+ */
+constexpr int MaxTablePlayers = 20;
+
+/*!
+ * Returns the player with white and the player with black on \a board of
+ * \a round in a single round-robin of \a players players, both zero based.
+ *
+ * \a players must be even.
+ */
+constexpr std::pair<int, int> pairing(int players, int round, int board)
+{
+    const auto n = players - 1;
+
+    // Opponent of the last player, advances n / 2 positions every round
+    const auto first = (round * (players / 2)) % n;
+
+    if (board == 0) {
+        return round % 2 == 0 ? std::pair{first, n} : std::pair{n, first};
+    }
+
+    return {(first + board) % n, (first - board + n) % n};
+}
+
+/*!
+ * Returns the number of rounds of a round-robin of \a players players.
+ */
+constexpr int numberOfRounds(int players, bool doubleRoundRobin = false)
+{
+    const auto even = players + players % 2;
+    return (even - 1) * (doubleRoundRobin ? 2 : 1);
+}
+
+/*!
+ * Pairings of one round, as pairs of player indices.
+ */
+using Pairs = std::vector<std::pair<int, int>>;
+
+/*!
+ * Returns the pairings of \a round, zero based, of a round-robin of \a players players.
+ *
+ * In a double round-robin, the second cycle repeats the first one with the colors
+ * reversed. The player without an opponent in a round is paired with -1.
+ */
+Pairs pairings(int players, int round, bool doubleRoundRobin = false);
+}
+
+/*!
+ * \class RoundRobinPairingBackend
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/roundrobin.h
+ *
+ * \brief Pairing backend for round-robin tournaments, using the Berger tables.
+ *
+ * The pairings of a round only depend on the number of players, so results and
+ * requested byes are not taken into account.
+ */
+class RoundRobinPairingBackend : public PairingBackend
+{
+public:
+    explicit RoundRobinPairingBackend(bool doubleRoundRobin);
+
+    [[nodiscard]] QString name() const override;
+
+    QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> pair(Tournament *tournament, int round) override;
+
+private:
+    bool m_doubleRoundRobin;
+};
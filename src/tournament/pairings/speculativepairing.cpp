@@ -0,0 +1,269 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "speculativepairing.h"
+
+#include <QFuture>
+#include <QPromise>
+#include <QThread>
+#include <QtConcurrentRun>
+
+#include <algorithm>
+#include <array>
+
+#include "builtinbackend.h"
+#include "pairingcache.h"
+#include "pairingsnapshot.h"
+#include "tournament.h"
+
+namespace
+{
+using Outcome = std::pair<Pairing::PartialResult, Pairing::PartialResult>;
+
+constexpr std::array<Outcome, 3> outcomes = {
+    Outcome{Pairing::PartialResult::Win, Pairing::PartialResult::Lost},
+    Outcome{Pairing::PartialResult::Draw, Pairing::PartialResult::Draw},
+    Outcome{Pairing::PartialResult::Lost, Pairing::PartialResult::Win},
+};
+}
+
+SpeculativePairing::SpeculativePairing(QObject *parent)
+    : QObject(parent)
+{
+    m_pool.setMaxThreadCount(std::max(1, QThread::idealThreadCount() / 2));
+}
+
+SpeculativePairing::~SpeculativePairing()
+{
+    clear();
+    m_pool.waitForDone();
+}
+
+void SpeculativePairing::setMaxThreads(int maxThreads)
+{
+    m_pool.setMaxThreadCount(std::max(1, maxThreads));
+}
+
+void SpeculativePairing::setMaxScenarios(int maxScenarios)
+{
+    m_maxScenarios = std::max(1, maxScenarios);
+
+    if (m_scenarios.size() > m_maxScenarios) {
+        clear();
+    }
+}
+
+void SpeculativePairing::setMaxMemory(qsizetype maxMemory)
+{
+    m_maxMemory = std::max<qsizetype>(0, maxMemory);
+
+    if (m_base && m_scenarios.size() > affordableScenarios(*m_base)) {
+        clear();
+    }
+}
+
+void SpeculativePairing::update(Tournament *tournament)
+{
+    const auto round = tournament->currentRound();
+
+    // The pairings of a round-robin do not depend on the results
+    if (round < 1 || round >= tournament->numberOfRounds() || tournament->pairingEngine() != Tournament::PairingEngine::BuiltIn || tournament->isRoundRobin()) {
+        clear();
+        return;
+    }
+
+    auto base = PairingSnapshot::fromTournament(tournament, round + 1);
+
+    // The scenarios being computed are still valid if only the results of their
+    // pending games changed, and every result entered is one of the outcomes.
+    if (m_base && m_round == round) {
+        std::vector<Outcome> results;
+        results.reserve(m_pending->size());
+        for (const auto &[white, black] : *m_pending) {
+            results.emplace_back(base.result(white, round - 1), base.result(black, round - 1));
+            base.setResult(round - 1, white, Pairing::PartialResult::Unknown);
+            base.setResult(round - 1, black, Pairing::PartialResult::Unknown);
+        }
+
+        const bool unchanged = base.hash() == m_baseHash;
+
+        std::vector<int> entered(results.size(), -1);
+        bool compatible = true;
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const auto &[white, black] = m_pending->at(i);
+            base.setResult(round - 1, white, results[i].first);
+            base.setResult(round - 1, black, results[i].second);
+
+            if (results[i].first == Pairing::PartialResult::Unknown || results[i].second == Pairing::PartialResult::Unknown) {
+                continue;
+            }
+            const auto it = std::ranges::find(outcomes, results[i]);
+            if (it == outcomes.cend()) {
+                compatible = false;
+            } else {
+                entered[i] = static_cast<int>(it - outcomes.cbegin());
+            }
+        }
+
+        if (unchanged && compatible) {
+            const auto keys = m_scenarios.keys();
+            for (const auto scenario : keys) {
+                const auto choice = m_scenarios.value(scenario).outcomes;
+                for (std::size_t i = 0; i < entered.size(); ++i) {
+                    if (entered[i] >= 0 && choice[i] != entered[i]) {
+                        remove(scenario);
+                        break;
+                    }
+                }
+            }
+            return;
+        }
+    }
+
+    // Games of the current round without a result, as indices of the players
+    std::vector<std::pair<int, int>> pending;
+
+    const auto pairings = tournament->pairings(round);
+    for (const auto &pairing : pairings) {
+        if (pairing->blackPlayer() == nullptr) {
+            continue;
+        }
+        if (pairing->whiteResult() == Pairing::PartialResult::Unknown || pairing->blackResult() == Pairing::PartialResult::Unknown) {
+            pending.emplace_back(pairing->whitePlayer()->startingRank() - 1, pairing->blackPlayer()->startingRank() - 1);
+        }
+    }
+
+    start(tournament, std::move(base), std::move(pending));
+}
+
+std::optional<SpeculativePairing::Pairings> SpeculativePairing::result(const QByteArray &key) const
+{
+    const auto it = m_results.constFind(key);
+    if (it == m_results.cend()) {
+        return std::nullopt;
+    }
+
+    return *it;
+}
+
+void SpeculativePairing::clear()
+{
+    ++m_generation;
+
+    for (auto &scenario : m_scenarios) {
+        scenario.future.cancel();
+    }
+    m_pool.clear();
+
+    m_scenarios.clear();
+    m_results.clear();
+    m_base.reset();
+    m_pending.reset();
+    m_baseHash.clear();
+    m_round = 0;
+}
+
+qsizetype SpeculativePairing::affordableScenarios(const PairingSnapshot &snapshot) const
+{
+    // Every thread pairs its own copy of the snapshot, and every scenario keeps
+    // its pairings and its key
+    const auto snapshots = static_cast<qsizetype>(m_pool.maxThreadCount() + 1) * static_cast<qsizetype>(snapshot.memoryUsage());
+    const auto perScenario = static_cast<qsizetype>((snapshot.numberOfPlayers() / 2 + 1) * sizeof(std::pair<uint, uint>) + sizeof(Scenario) + 64);
+
+    return std::max<qsizetype>(0, (m_maxMemory - snapshots) / perScenario);
+}
+
+void SpeculativePairing::start(Tournament *tournament, PairingSnapshot &&base, std::vector<std::pair<int, int>> &&pending)
+{
+    clear();
+
+    const auto limit = std::min<qsizetype>(m_maxScenarios, affordableScenarios(base));
+
+    qsizetype scenarios = 1;
+    for (std::size_t i = 0; i < pending.size(); ++i) {
+        scenarios *= static_cast<qsizetype>(outcomes.size());
+        if (scenarios > limit) {
+            return;
+        }
+    }
+    if (scenarios > limit) {
+        return;
+    }
+
+    const auto round = tournament->currentRound();
+    const auto pairingSystem = tournament->pairingSystem();
+    const auto system = BuiltInPairingBackend::engineSystem(pairingSystem);
+
+    m_round = round;
+    m_baseHash = base.hash();
+    m_base = std::make_shared<const PairingSnapshot>(std::move(base));
+    m_pending = std::make_shared<const std::vector<std::pair<int, int>>>(std::move(pending));
+    m_scenarios.reserve(scenarios);
+
+    for (qsizetype scenario = 0; scenario < scenarios; ++scenario) {
+        Outcomes choice(m_pending->size());
+
+        auto remaining = scenario;
+        for (auto &outcome : choice) {
+            outcome = static_cast<std::uint8_t>(remaining % static_cast<qsizetype>(outcomes.size()));
+            remaining /= static_cast<qsizetype>(outcomes.size());
+        }
+
+        // The snapshot and the key are built in the thread pool, so entering a
+        // result doesn't wait for them
+        auto future = QtConcurrent::run(&m_pool, [base = m_base, pending = m_pending, choice, round, pairingSystem, system](QPromise<Result> &promise) {
+            if (promise.isCanceled()) {
+                return;
+            }
+
+            auto snapshot = *base;
+            for (std::size_t i = 0; i < choice.size(); ++i) {
+                const auto &[white, black] = pending->at(i);
+                const auto &[whiteResult, blackResult] = outcomes.at(choice[i]);
+                snapshot.setResult(round - 1, white, whiteResult);
+                snapshot.setResult(round - 1, black, blackResult);
+            }
+
+            Result result;
+            result.key = PairingCache::key(snapshot, pairingSystem, Tournament::PairingEngine::BuiltIn);
+
+            if (promise.isCanceled()) {
+                return;
+            }
+
+            SwissPairingEngine engine{system};
+            if (const auto pairs = engine.pair(snapshot)) {
+                result.pairings = BuiltInPairingBackend::toStartingRanks(*pairs);
+            }
+            promise.addResult(std::move(result));
+        });
+
+        future.then(this, [this, generation = m_generation, scenario](const Result &result) {
+            const auto it = m_scenarios.find(scenario);
+            if (generation != m_generation || it == m_scenarios.end()) {
+                return;
+            }
+
+            it->key = result.key;
+            if (result.pairings) {
+                m_results.insert(result.key, *result.pairings);
+            }
+        });
+
+        m_scenarios.insert(scenario, Scenario{std::move(choice), future, {}});
+    }
+}
+
+void SpeculativePairing::remove(qsizetype scenario)
+{
+    const auto it = m_scenarios.find(scenario);
+    if (it == m_scenarios.end()) {
+        return;
+    }
+
+    it->future.cancel();
+    if (!it->key.isEmpty()) {
+        m_results.remove(it->key);
+    }
+    m_scenarios.erase(it);
+}
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QByteArray>
+#include <QFuture>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QThreadPool>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+class PairingSnapshot;
+class Tournament;
+
+/*!
+ * \class SpeculativePairing
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/speculativepairing.h
+ *
+ * \brief Computes the pairings of the next round before the current one finishes.
+ *
+ * When only a few games of the current round are still being played, the pairings
+ * of the next round are computed in the background for every combination of their
+ * outcomes (win, draw or loss). Once the last result is entered, the pairings are
+ * usually already available.
+ *
+ * All the outcomes share a single snapshot of the tournament. Each job only gets
+ * the outcomes of the pending games, and builds its own snapshot and its
+ * PairingCache key in the thread pool. Jobs for outcomes that are no longer
+ * possible are canceled.
+ *
+ * The results are keyed like the PairingCache, so a forfeit or any other change to
+ * the tournament simply misses and the round is paired as usual.
+ */
+class SpeculativePairing : public QObject
+{
+    Q_OBJECT
+
+public:
+    using Pairings = QList<std::pair<uint, uint>>;
+
+    explicit SpeculativePairing(QObject *parent = nullptr);
+    ~SpeculativePairing() override;
+
+    /*!
+     * Sets the maximum number of threads used to compute the pairings.
+     */
+    void setMaxThreads(int maxThreads);
+
+    /*!
+     * Sets the maximum number of outcome combinations computed and kept in memory.
+     *
+     * As each pending game has three outcomes, this also limits the number of
+     * pending games: 243 combinations allow up to five of them.
+     */
+    void setMaxScenarios(int maxScenarios);
+
+    /*!
+     * Sets the approximate maximum memory, in bytes, used by the snapshots being
+     * paired and the computed pairings.
+     *
+     * Combinations that don't fit are not computed, even if they are fewer than
+     * the maximum number of combinations.
+     */
+    void setMaxMemory(qsizetype maxMemory);
+
+    /*!
+     * Starts computing the pairings of the round after the current round of
+     * \a tournament, if few enough games are pending.
+     *
+     * Pairings already computed for outcomes that are still possible are kept.
+     */
+    void update(Tournament *tournament);
+
+    /*!
+     * Returns the pairings computed for the PairingCache \a key, or std::nullopt if
+     * they are not available (yet).
+     */
+    [[nodiscard]] std::optional<Pairings> result(const QByteArray &key) const;
+
+    /*!
+     * Cancels the pending jobs and discards all the computed pairings.
+     */
+    void clear();
+
+private:
+    using Outcomes = std::vector<std::uint8_t>;
+
+    struct Result {
+        QByteArray key;
+        std::optional<Pairings> pairings;
+    };
+
+    struct Scenario {
+        Outcomes outcomes;
+        QFuture<Result> future;
+        QByteArray key;
+    };
+
+    [[nodiscard]] qsizetype affordableScenarios(const PairingSnapshot &snapshot) const;
+    void start(Tournament *tournament, PairingSnapshot &&base, std::vector<std::pair<int, int>> &&pending);
+    void remove(qsizetype scenario);
+
+    QThreadPool m_pool;
+    int m_maxScenarios = 243;
+    qsizetype m_maxMemory = 256 * 1024 * 1024;
+
+    // Snapshot shared by the scenarios, with the pending games of the current
+    // round without result, and its hash
+    std::shared_ptr<const PairingSnapshot> m_base;
+    std::shared_ptr<const std::vector<std::pair<int, int>>> m_pending;
+    QByteArray m_baseHash;
+    int m_round = 0;
+    int m_generation = 0;
+
+    QHash<qsizetype, Scenario> m_scenarios;
+    QHash<QByteArray, Pairings> m_results;
+};
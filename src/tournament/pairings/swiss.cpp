@@ -0,0 +1,1783 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "swiss.h"
+
+#include "matching.h"
+#include "pairingsnapshot.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+
+namespace
+{
+
+enum class Strength : std::uint8_t {
+    None,
+    Mild,
+    Strong,
+    Absolute,
+};
+
+enum class Float : std::uint8_t {
+    None,
+    Down,
+    Up,
+};
+
+struct Entry {
+    int player = 0;
+    int score = 0; // In half points
+    int played = 0;
+    int unplayed = 0;
+    int colorDifference = 0;
+    int rating = 0;
+    int averageOpponentRating = 0;
+    int buchholz = 0; // In half points
+    int sonnebornBerger = 0; // In quarter points
+    Pairing::Color lastColor = Pairing::Color::Unknown;
+    Pairing::Color secondLastColor = Pairing::Color::Unknown;
+    Pairing::Color preference = Pairing::Color::Unknown;
+    Strength strength = Strength::None;
+    Float lastFloat = Float::None;
+    Float previousFloat = Float::None;
+    bool topscorer = false;
+    bool canGetBye = true;
+};
+
+/*
+ * Players to pair, sorted by score and pairing number. Players are identified by
+ * their position in this order.
+ */
+class Context
+{
+public:
+    explicit Context(const PairingSnapshot &snapshot)
+        : m_initialColor(snapshot.initialColor())
+        , m_numberOfPlayers(snapshot.numberOfPlayers())
+        , m_rounds(snapshot.playedRounds())
+        , m_colors(static_cast<std::size_t>(m_numberOfPlayers) * m_rounds, Pairing::Color::Unknown)
+    {
+        const int numberOfPlayers = m_numberOfPlayers;
+        const int rounds = m_rounds;
+        const bool finalRound = rounds + 1 >= snapshot.numberOfRounds();
+
+        // Scores before each round, in half points
+        std::vector<int> scores(static_cast<std::size_t>(numberOfPlayers) * (rounds + 1), 0);
+        const auto scoreBefore = [&](int player, int round) -> int & {
+            return scores[static_cast<std::size_t>(round) * numberOfPlayers + player];
+        };
+        for (int r = 0; r < rounds; ++r) {
+            for (int p = 0; p < numberOfPlayers; ++p) {
+                scoreBefore(p, r + 1) = scoreBefore(p, r) + static_cast<int>(std::lround(2 * Pairing::pointsForResult(snapshot.result(p, r))));
+            }
+        }
+
+        const auto floatIn = [&](int player, int round) {
+            if (round < 0) {
+                return Float::None;
+            }
+            if (!snapshot.hasPlayed(player, round)) {
+                return Float::Down;
+            }
+            const auto own = scoreBefore(player, round);
+            const auto opponent = scoreBefore(snapshot.opponent(player, round), round);
+            if (opponent > own) {
+                return Float::Up;
+            }
+            if (opponent < own) {
+                return Float::Down;
+            }
+            return Float::None;
+        };
+
+        for (int p = 0; p < numberOfPlayers; ++p) {
+            if (!snapshot.isAvailable(p)) {
+                continue;
+            }
+
+            Entry entry;
+            entry.player = p;
+            entry.score = scoreBefore(p, rounds);
+            entry.rating = snapshot.rating(p);
+
+            long long opponentRatings = 0;
+
+            for (int r = 0; r < rounds; ++r) {
+                const auto result = snapshot.result(p, r);
+                if (result == Pairing::PartialResult::PairingBye || result == Pairing::PartialResult::WinForfeit) {
+                    entry.canGetBye = false;
+                }
+                if (!snapshot.hasPlayed(p, r)) {
+                    ++entry.unplayed;
+                    continue;
+                }
+                ++entry.played;
+
+                const auto opponent = snapshot.opponent(p, r);
+                const auto opponentScore = scoreBefore(opponent, rounds);
+                entry.buchholz += opponentScore;
+                entry.sonnebornBerger += opponentScore * static_cast<int>(std::lround(2 * Pairing::pointsForResult(result)));
+                opponentRatings += snapshot.rating(opponent);
+
+                const auto color = snapshot.color(p, r);
+                m_colors[static_cast<std::size_t>(r) * numberOfPlayers + p] = color;
+                entry.colorDifference += color == Pairing::Color::White ? 1 : -1;
+                entry.secondLastColor = entry.lastColor;
+                entry.lastColor = color;
+            }
+
+            if (entry.played > 0) {
+                entry.averageOpponentRating = static_cast<int>(std::lround(static_cast<double>(opponentRatings) / entry.played));
+            }
+
+            computePreference(entry);
+
+            entry.lastFloat = floatIn(p, rounds - 1);
+            entry.previousFloat = floatIn(p, rounds - 2);
+            entry.topscorer = finalRound && entry.score > snapshot.numberOfRounds();
+
+            m_entries.push_back(entry);
+        }
+
+        std::ranges::sort(m_entries, [](const Entry &a, const Entry &b) {
+            if (a.score != b.score) {
+                return a.score > b.score;
+            }
+            return a.player < b.player;
+        });
+
+        const auto n = m_entries.size();
+        std::vector<int> positions(numberOfPlayers, -1);
+        for (std::size_t i = 0; i < n; ++i) {
+            positions[m_entries[i].player] = static_cast<int>(i);
+        }
+
+        m_met.assign(n * n, false);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (int r = 0; r < rounds; ++r) {
+                if (!snapshot.hasPlayed(m_entries[i].player, r)) {
+                    continue;
+                }
+                const auto opponent = positions[snapshot.opponent(m_entries[i].player, r)];
+                if (opponent >= 0) {
+                    m_met[i * n + opponent] = true;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] const std::vector<Entry> &entries() const
+    {
+        return m_entries;
+    }
+
+    [[nodiscard]] bool compatible(int a, int b) const
+    {
+        if (m_met[static_cast<std::size_t>(a) * m_entries.size() + b]) {
+            return false;
+        }
+        const auto &x = m_entries[a];
+        const auto &y = m_entries[b];
+        return !(isAbsoluteNonTopscorer(x) && isAbsoluteNonTopscorer(y) && x.preference == y.preference);
+    }
+
+    /*
+     * Returns the positions of the players with white and black, following the
+     * color allocation rules (E.1-E.5).
+     */
+    [[nodiscard]] std::pair<int, int> allocateColors(int a, int b) const
+    {
+        const int higher = std::min(a, b);
+        const int lower = std::max(a, b);
+        const auto &h = m_entries[higher];
+        const auto &l = m_entries[lower];
+
+        const auto higherGets = [&](Pairing::Color color) {
+            return color == Pairing::Color::White ? std::pair{higher, lower} : std::pair{lower, higher};
+        };
+        const auto opposite = [](Pairing::Color color) {
+            return color == Pairing::Color::White ? Pairing::Color::Black : Pairing::Color::White;
+        };
+
+        // E.5: no preferences
+        if (h.preference == Pairing::Color::Unknown && l.preference == Pairing::Color::Unknown) {
+            return higherGets((h.player + 1) % 2 == 1 ? m_initialColor : opposite(m_initialColor));
+        }
+
+        // E.1: both preferences can be granted
+        if (h.preference == Pairing::Color::Unknown) {
+            return higherGets(opposite(l.preference));
+        }
+        if (l.preference == Pairing::Color::Unknown || h.preference != l.preference) {
+            return higherGets(h.preference);
+        }
+
+        // E.2: grant the stronger preference
+        if (h.strength != l.strength) {
+            return h.strength > l.strength ? higherGets(h.preference) : higherGets(opposite(l.preference));
+        }
+        if (h.strength == Strength::Absolute && std::abs(h.colorDifference) != std::abs(l.colorDifference)) {
+            return std::abs(h.colorDifference) > std::abs(l.colorDifference) ? higherGets(h.preference) : higherGets(opposite(l.preference));
+        }
+
+        // E.3: alternate to the most recent round with different colors
+        if (const auto color = lastDifferentColor(h.player, l.player); color != Pairing::Color::Unknown) {
+            return higherGets(opposite(color));
+        }
+
+        // E.4: grant the preference of the higher ranked player
+        return higherGets(h.preference);
+    }
+
+    /*
+     * Returns whether \a players can be paired among themselves, giving the bye
+     * to one of them if their number is odd. The first \a independent players
+     * can't be paired with each other.
+     */
+    [[nodiscard]] bool isCompletable(const std::vector<int> &players, int independent = 0) const
+    {
+        const int n = static_cast<int>(players.size());
+        if (n == 0) {
+            return true;
+        }
+
+        const bool odd = n % 2 == 1;
+        int eligible = 0;
+        int absoluteWhite = 0;
+        int absoluteBlack = 0;
+        for (const int p : players) {
+            const auto &entry = m_entries[p];
+            eligible += entry.canGetBye ? 1 : 0;
+            if (isAbsoluteNonTopscorer(entry)) {
+                ++(entry.preference == Pairing::Color::White ? absoluteWhite : absoluteBlack);
+            }
+        }
+        if (odd && eligible == 0) {
+            return false;
+        }
+        if (2 * independent > n + 1) {
+            return false;
+        }
+
+        // Dirac: a graph where every vertex has degree of at least half the number
+        // of vertices has a perfect matching.
+        const int vertices = n + (odd ? 1 : 0);
+        const int half = vertices / 2;
+        bool dirac = !odd || eligible >= half;
+        for (int i = 0; dirac && i < n; ++i) {
+            const auto &entry = m_entries[players[i]];
+            int excluded = std::min(entry.played, n - 1);
+            if (isAbsoluteNonTopscorer(entry)) {
+                excluded += (entry.preference == Pairing::Color::White ? absoluteWhite : absoluteBlack) - 1;
+            }
+            if (i < independent) {
+                excluded += independent - 1;
+            }
+            const int degree = n - 1 - excluded + (odd && entry.canGetBye ? 1 : 0);
+            dirac = degree >= half;
+        }
+        if (dirac) {
+            return true;
+        }
+
+        const int bye = n;
+        m_graph.reset(vertices);
+        m_graph.reserve(vertices, static_cast<std::size_t>(n) * (n - 1) / 2 + n);
+        for (int i = 0; i < n; ++i) {
+            for (int j = std::max(i + 1, independent); j < n; ++j) {
+                if (compatible(players[i], players[j])) {
+                    m_graph.addEdge(i, j, 1);
+                }
+            }
+            if (odd && m_entries[players[i]].canGetBye) {
+                m_graph.addEdge(i, bye, 1);
+            }
+        }
+        m_graph.build();
+
+        m_matching.solve(m_graph, true);
+        return m_matching.size() * 2 == vertices;
+    }
+
+private:
+    static void computePreference(Entry &entry)
+    {
+        if (entry.played == 0) {
+            return;
+        }
+
+        const auto opposite = entry.lastColor == Pairing::Color::White ? Pairing::Color::Black : Pairing::Color::White;
+
+        if (entry.colorDifference > 1) {
+            entry.preference = Pairing::Color::Black;
+            entry.strength = Strength::Absolute;
+        } else if (entry.colorDifference < -1) {
+            entry.preference = Pairing::Color::White;
+            entry.strength = Strength::Absolute;
+        } else if (entry.played >= 2 && entry.lastColor == entry.secondLastColor) {
+            entry.preference = opposite;
+            entry.strength = Strength::Absolute;
+        } else if (entry.colorDifference == 1) {
+            entry.preference = Pairing::Color::Black;
+            entry.strength = Strength::Strong;
+        } else if (entry.colorDifference == -1) {
+            entry.preference = Pairing::Color::White;
+            entry.strength = Strength::Strong;
+        } else {
+            entry.preference = opposite;
+            entry.strength = Strength::Mild;
+        }
+    }
+
+    static bool isAbsoluteNonTopscorer(const Entry &entry)
+    {
+        return entry.strength == Strength::Absolute && !entry.topscorer;
+    }
+
+    /*
+     * Returns the color of player \a a in the most recent round where \a a and
+     * \a b played with different colors.
+     */
+    [[nodiscard]] Pairing::Color lastDifferentColor(int a, int b) const
+    {
+        for (int r = m_rounds - 1; r >= 0; --r) {
+            const auto colorA = m_colors[static_cast<std::size_t>(r) * m_numberOfPlayers + a];
+            const auto colorB = m_colors[static_cast<std::size_t>(r) * m_numberOfPlayers + b];
+            if (colorA != Pairing::Color::Unknown && colorB != Pairing::Color::Unknown && colorA != colorB) {
+                return colorA;
+            }
+        }
+        return Pairing::Color::Unknown;
+    }
+
+    Pairing::Color m_initialColor;
+    int m_numberOfPlayers;
+    int m_rounds;
+    std::vector<Entry> m_entries;
+    std::vector<bool> m_met;
+
+    // Colors of the games played over the board: [round * numberOfPlayers + player]
+    std::vector<Pairing::Color> m_colors;
+
+    // Reused by every completability check
+    mutable MatchingGraph m_graph;
+    mutable MaximumWeightMatching m_matching;
+};
+
+/*
+ * Packs several criteria in the components of a LexicographicWeight.
+ *
+ * Criteria are added from the most important to the least important one. Each of
+ * them is multiplied by the range of the criteria after it in the same component,
+ * which is wide enough for their sum over any matching, so comparing the weights of
+ * two matchings compares the criteria in order.
+ */
+class WeightLayout
+{
+public:
+    /*
+     * Adds a criterion whose value for a pair is at most \a bound in absolute value,
+     * and which is not zero for more than \a pairs pairs of a matching. If
+     * \a newComponent is true, the criterion starts a new component.
+     *
+     * Returns the index of the criterion.
+     */
+    int add(std::int64_t bound, std::int64_t pairs, bool newComponent = false)
+    {
+        m_criteria.push_back({.range = 4 * std::max<std::int64_t>(bound, 1) * std::max<std::int64_t>(pairs, 1) + 1, .newComponent = newComponent});
+        return static_cast<int>(m_criteria.size()) - 1;
+    }
+
+    /*
+     * Removes the criteria after the first \a size ones.
+     */
+    void resize(int size)
+    {
+        m_criteria.resize(size);
+    }
+
+    [[nodiscard]] int size() const
+    {
+        return static_cast<int>(m_criteria.size());
+    }
+
+    /*
+     * Assigns the components of the criteria. The criteria that don't fit in a
+     * LexicographicWeight are ignored.
+     */
+    void build()
+    {
+        std::size_t component = 0;
+        std::int64_t product = 1;
+        for (std::size_t i = 0; i < m_criteria.size(); ++i) {
+            auto &criterion = m_criteria[i];
+            if (i > 0 && (criterion.newComponent || product > Limit / criterion.range)) {
+                ++component;
+                product = 1;
+            }
+            criterion.component = component;
+            product *= criterion.range;
+        }
+
+        std::int64_t multiplier = 1;
+        for (auto i = m_criteria.size(); i-- > 0;) {
+            auto &criterion = m_criteria[i];
+            if (i + 1 == m_criteria.size() || m_criteria[i + 1].component != criterion.component) {
+                multiplier = 1;
+            }
+            criterion.multiplier = criterion.component < LexicographicWeight::Size ? multiplier : 0;
+            multiplier *= criterion.range;
+        }
+    }
+
+    [[nodiscard]] bool fits(int criterion) const
+    {
+        return m_criteria[criterion].multiplier != 0;
+    }
+
+    /*
+     * Adds \a value to \a criterion of \a weight. Negative criteria are ignored.
+     */
+    void add(LexicographicWeight &weight, int criterion, std::int64_t value) const
+    {
+        if (criterion < 0 || value == 0) {
+            return;
+        }
+        const auto &c = m_criteria[criterion];
+        if (c.multiplier != 0) {
+            weight[c.component] += value * c.multiplier;
+        }
+    }
+
+    /*
+     * Returns whether \a a and \a b are equal in the components of the criteria
+     * from \a first to \a last.
+     */
+    [[nodiscard]] bool equal(const LexicographicWeight &a, const LexicographicWeight &b, int first, int last) const
+    {
+        const auto end = std::min(m_criteria[last].component + 1, LexicographicWeight::Size);
+        for (auto c = m_criteria[first].component; c < end; ++c) {
+            if (a[c] != b[c]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    // Largest product of ranges in a component, leaving room for the sums of the
+    // matching algorithm
+    static constexpr std::int64_t Limit = std::int64_t{1} << 58;
+
+    struct Criterion {
+        std::int64_t range = 1;
+        bool newComponent = false;
+        std::size_t component = 0;
+        std::int64_t multiplier = 0;
+    };
+    std::vector<Criterion> m_criteria;
+};
+
+struct Candidate {
+    std::vector<std::pair<int, int>> pairs;
+    std::vector<int> floaters;
+};
+
+/*
+ * Pairing of the bracket formed by the moved players \a mdps and the players of
+ * the score group \a residents, in the order of the system. The players in \a next
+ * form the following bracket, and the ones in \a rest are paired after it.
+ *
+ * The quality criteria (C.5-C.21) are encoded in the weights of the pairs, so a
+ * maximum weight matching of the bracket is one of its best candidates. If the
+ * bracket can't be paired completely, the matching includes the next bracket
+ * (C.7). Every matching must leave the rest of the players pairable (C.4), and
+ * otherwise it is computed again including all of them.
+ *
+ * Then, the best candidate that comes first in the generation order of the system
+ * (D.1-D.3) is found by fixing the exchanges and the pairs one at a time, keeping
+ * the weight of the best candidate.
+ */
+class BracketPairing
+{
+public:
+    explicit BracketPairing(const Context &context,
+                            SwissPairingEngine::System system,
+                            const std::vector<int> &mdps,
+                            const std::vector<int> &residents,
+                            const std::vector<int> &next,
+                            const std::vector<int> &rest,
+                            bool upwards,
+                            long long &solved)
+        : m_context(context)
+        , m_system(system)
+        , m_mdpList(mdps)
+        , m_residentList(residents)
+        , m_next(next)
+        , m_rest(rest)
+        , m_upwards(upwards)
+        , m_solved(solved)
+        , m_mdps(static_cast<int>(mdps.size()))
+        , m_bracket(static_cast<int>(mdps.size() + residents.size()))
+    {
+    }
+
+    std::optional<Candidate> run()
+    {
+        setUp(false);
+        auto solution = solve();
+        if (solution && !m_next.empty() && floats(*solution)) {
+            setUp(true);
+            solution = solve();
+        }
+        if (!solution) {
+            return std::nullopt;
+        }
+        m_target = solution->weight;
+        m_mates = std::move(solution->mates);
+
+        pairMdps();
+        pairRemainder();
+
+        Candidate candidate;
+        for (int v = 0; v < m_bracket; ++v) {
+            if (m_forced[v] < 0) {
+                candidate.floaters.push_back(m_players[v]);
+            } else if (m_forced[v] > v) {
+                candidate.pairs.emplace_back(m_players[v], m_players[m_forced[v]]);
+            }
+        }
+        return candidate;
+    }
+
+private:
+    enum class Side : std::uint8_t {
+        None,
+        S1,
+        S2,
+        Limbo,
+    };
+
+    enum class Phase : std::uint8_t {
+        Quality,
+        MdpExchange,
+        Exchange,
+        Transposition,
+    };
+
+    struct Solution {
+        std::vector<int> mates;
+        LexicographicWeight weight;
+    };
+
+    [[nodiscard]] const Entry &entry(int v) const
+    {
+        return m_context.entries()[m_players[v]];
+    }
+
+    /*
+     * Sets up the players and the criteria of the matching, including the next
+     * bracket if \a lookahead is true.
+     */
+    void setUp(bool lookahead)
+    {
+        m_lookahead = lookahead;
+
+        m_players = m_mdpList;
+        m_players.insert(m_players.end(), m_residentList.begin(), m_residentList.end());
+        m_others = m_rest;
+        (lookahead ? m_players : m_others).insert((lookahead ? m_players : m_others).end(), m_next.begin(), m_next.end());
+        m_vertices = static_cast<int>(m_players.size());
+
+        m_forced.assign(m_vertices, -1);
+        m_side.assign(m_vertices, Side::None);
+        m_rank.assign(m_vertices, 0);
+        m_second.assign(m_vertices, false);
+        m_priority.assign(m_vertices, -1);
+        m_position.assign(m_vertices, -1);
+        m_phase = Phase::Quality;
+
+        const auto &entries = m_context.entries();
+        const int residentScore = entries[m_residentList.front()].score;
+        m_artificial = residentScore + (m_upwards ? 2 : -2);
+        m_nextArtificial = m_next.empty() ? 0 : entries[m_next.front()].score - 2;
+
+        std::vector<int> scores;
+        bool topscorers = false;
+        bool floated = false;
+        int unplayed = 0;
+        for (int v = 0; v < m_bracket; ++v) {
+            const auto &e = entry(v);
+            scores.push_back(e.score);
+            topscorers = topscorers || e.topscorer;
+            floated = floated || e.lastFloat != Float::None || e.previousFloat != Float::None;
+            unplayed = std::max(unplayed, e.unplayed);
+        }
+        std::ranges::sort(scores);
+        const auto [first, last] = std::ranges::unique(scores);
+        scores.erase(first, last);
+
+        const std::int64_t pairs = m_vertices / 2 + 1;
+
+        m_layout = {};
+        m_cardinality = m_layout.add(1, (m_vertices + static_cast<std::int64_t>(m_others.size())) / 2 + 1);
+
+        // C.5: number of pairs
+        m_pairs = m_layout.add(1, pairs, true);
+
+        // C.6: pairing score differences, from the largest one
+        std::vector<int> values;
+        for (const int a : scores) {
+            values.push_back(floatDifference(a));
+            for (const int b : scores) {
+                values.push_back(std::abs(a - b));
+            }
+        }
+        m_psd = addDifferences(values, pairs);
+
+        // C.7: pairs and pairing score differences of the next bracket
+        m_nextPairs = -1;
+        m_nextPsd.clear();
+        if (lookahead) {
+            const int nextScore = entries[m_next.front()].score;
+            values.clear();
+            values.push_back(nextFloatDifference(nextScore));
+            values.push_back(0);
+            for (const int a : scores) {
+                values.push_back(nextFloatDifference(a));
+                values.push_back(std::abs(a - nextScore));
+            }
+            m_nextPairs = m_layout.add(1, pairs);
+            m_nextPsd = addDifferences(values, pairs);
+        }
+
+        // C.9: unplayed games of the player receiving the bye
+        m_byeUnplayed = m_rest.empty() && m_next.empty() && unplayed > 0 ? m_layout.add(2 * unplayed, pairs) : -1;
+
+        // C.10, C.11: color differences and repeated colors of topscorers
+        m_topscorerDifference = topscorers ? m_layout.add(2, pairs) : -1;
+        m_topscorerRepeated = topscorers ? m_layout.add(2, pairs) : -1;
+
+        // C.12, C.13: color preferences and strong color preferences
+        m_preference = m_layout.add(2, pairs);
+        m_strongPreference = m_layout.add(2, pairs);
+
+        // C.14-C.17: repeated floats, and C.18-C.21: their score differences
+        const int maxDifference = scores.empty() ? 0 : std::max(std::abs(scores.back() - m_artificial), std::abs(scores.front() - m_artificial));
+        for (auto &criterion : m_floats) {
+            criterion = floated ? m_layout.add(2, pairs) : -1;
+        }
+        for (auto &criterion : m_floatDifferences) {
+            criterion = floated ? m_layout.add(2 * maxDifference, pairs) : -1;
+        }
+
+        m_quality = m_layout.size();
+        m_layout.build();
+    }
+
+    /*
+     * Adds a criterion for every value in \a values, from the largest one, and
+     * returns the criterion of each value.
+     */
+    std::vector<int> addDifferences(std::vector<int> values, std::int64_t pairs)
+    {
+        std::ranges::sort(values, std::greater{});
+        std::vector<int> criteria(values.empty() ? 0 : values.front() + 1, -1);
+        for (const int value : values) {
+            if (criteria[value] < 0) {
+                criteria[value] = m_layout.add(2, pairs);
+            }
+        }
+        return criteria;
+    }
+
+    /*
+     * Returns the score difference of a floater with score \a score, against an
+     * artificial player one point below (or above, when floating up) the bracket.
+     */
+    [[nodiscard]] int floatDifference(int score) const
+    {
+        return std::abs(score - m_artificial);
+    }
+
+    [[nodiscard]] int nextFloatDifference(int score) const
+    {
+        return score - m_nextArtificial;
+    }
+
+    /*
+     * Sets up the criteria of the generation order for \a phase.
+     */
+    void setPhase(Phase phase)
+    {
+        m_phase = phase;
+        m_layout.resize(m_quality);
+        std::ranges::fill(m_priority, -1);
+
+        const auto maxRank = std::ranges::max(m_rank);
+        const std::int64_t pairs = m_vertices / 2 + 1;
+
+        switch (phase) {
+        case Phase::Quality:
+            break;
+        case Phase::MdpExchange:
+        case Phase::Exchange:
+            // Number of players exchanged, then difference of the sums of their
+            // pairing numbers
+            m_exchangeSize = m_layout.add(1, pairs, true);
+            m_exchangeDifference = m_layout.add(2 * maxRank, pairs);
+            break;
+        case Phase::Transposition:
+            // Position in S2 of the opponent of each player of S1, from the first one
+            for (const int v : m_transposed) {
+                m_priority[v] = m_layout.add(m_s2Size, 1, m_layout.size() == m_quality);
+            }
+            break;
+        }
+
+        m_layout.build();
+    }
+
+    [[nodiscard]] bool allowed(int u, int v) const
+    {
+        if (m_forced[u] >= 0 || m_forced[v] >= 0) {
+            return m_forced[u] == v;
+        }
+        if (!m_context.compatible(m_players[u], m_players[v])) {
+            return false;
+        }
+        if (u < m_bracket && v < m_bracket) {
+            if (u < m_mdps && v < m_mdps) {
+                return false;
+            }
+            if (m_side[u] == Side::Limbo || m_side[v] == Side::Limbo) {
+                return false;
+            }
+            if (m_side[u] != Side::None && m_side[u] == m_side[v]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] LexicographicWeight weight(int u, int v) const
+    {
+        LexicographicWeight weight;
+
+        const auto &a = entry(u);
+        const auto &b = entry(v);
+        const int difference = std::abs(a.score - b.score);
+
+        const auto addDifference = [this, &weight](const std::vector<int> &criteria, int value, int count) {
+            if (value >= 0 && value < static_cast<int>(criteria.size())) {
+                m_layout.add(weight, criteria[value], count);
+            }
+        };
+
+        if (u >= m_bracket || v >= m_bracket) {
+            // Pair of the next bracket, which only matters for C.7
+            m_layout.add(weight, m_nextPairs, 1);
+            addDifference(m_nextPsd, nextFloatDifference(a.score), 1);
+            addDifference(m_nextPsd, nextFloatDifference(b.score), 1);
+            addDifference(m_nextPsd, difference, -1);
+            return weight;
+        }
+
+        m_layout.add(weight, m_pairs, 1);
+        addDifference(m_psd, floatDifference(a.score), 1);
+        addDifference(m_psd, floatDifference(b.score), 1);
+        addDifference(m_psd, difference, -1);
+        if (m_lookahead) {
+            addDifference(m_nextPsd, nextFloatDifference(a.score), 1);
+            addDifference(m_nextPsd, nextFloatDifference(b.score), 1);
+        }
+
+        m_layout.add(weight, m_byeUnplayed, a.unplayed + b.unplayed);
+
+        const auto &entries = m_context.entries();
+        const auto [white, black] = m_context.allocateColors(m_players[u], m_players[v]);
+        const bool topscorers = a.topscorer || b.topscorer;
+        for (const auto &[player, color] : {std::pair{white, Pairing::Color::White}, std::pair{black, Pairing::Color::Black}}) {
+            const auto &e = entries[player];
+            if (topscorers) {
+                const auto colorDifference = e.colorDifference + (color == Pairing::Color::White ? 1 : -1);
+                m_layout.add(weight, m_topscorerDifference, std::abs(colorDifference) > 2 ? -1 : 0);
+                m_layout.add(weight, m_topscorerRepeated, e.played >= 2 && e.lastColor == color && e.secondLastColor == color ? -1 : 0);
+            }
+            if (e.preference != Pairing::Color::Unknown && e.preference != color) {
+                m_layout.add(weight, m_preference, -1);
+                m_layout.add(weight, m_strongPreference, e.strength >= Strength::Strong ? -1 : 0);
+            }
+        }
+
+        // Floats, relative to floating out of the bracket
+        const auto floats = [&](const Entry &x, const Entry &opponent) {
+            const bool down = x.score > opponent.score;
+            const bool up = x.score < opponent.score;
+            const std::array<Float, 2> history{x.lastFloat, x.previousFloat};
+            for (std::size_t i = 0; i < history.size(); ++i) {
+                if (history[i] == Float::Down) {
+                    m_layout.add(weight, m_floats[2 * i], down ? 0 : 1);
+                    m_layout.add(weight, m_floatDifferences[2 * i], floatDifference(x.score) - (down ? x.score - opponent.score : 0));
+                } else if (history[i] == Float::Up && up) {
+                    m_layout.add(weight, m_floats[2 * i + 1], -1);
+                    m_layout.add(weight, m_floatDifferences[2 * i + 1], x.score - opponent.score);
+                }
+            }
+        };
+        floats(a, b);
+        floats(b, a);
+
+        switch (m_phase) {
+        case Phase::Quality:
+            break;
+        case Phase::MdpExchange: {
+            const int mdp = u < m_mdps ? u : v;
+            if (mdp < m_mdps && m_rank[mdp] > 0) {
+                m_layout.add(weight, m_exchangeSize, m_second[mdp] ? -1 : 0);
+                m_layout.add(weight, m_exchangeDifference, -m_rank[mdp]);
+            }
+            break;
+        }
+        case Phase::Exchange:
+            if (m_rank[u] > 0 && m_rank[v] > 0) {
+                // The player of S1 stays in S1. With two players of S1, the lower
+                // one moves to S2, and with two players of S2 the higher one moves
+                // to S1.
+                int value = 0;
+                if (!m_second[u]) {
+                    value -= m_rank[u];
+                }
+                if (!m_second[v]) {
+                    value -= m_rank[v];
+                }
+                if (!m_second[u] && !m_second[v]) {
+                    value += std::max(m_rank[u], m_rank[v]);
+                }
+                if (m_second[u] && m_second[v]) {
+                    value -= std::min(m_rank[u], m_rank[v]);
+                    m_layout.add(weight, m_exchangeSize, -1);
+                }
+                m_layout.add(weight, m_exchangeDifference, value);
+            }
+            break;
+        case Phase::Transposition:
+            if (m_priority[u] >= 0 && m_position[v] >= 0) {
+                m_layout.add(weight, m_priority[u], -m_position[v]);
+            } else if (m_priority[v] >= 0 && m_position[u] >= 0) {
+                m_layout.add(weight, m_priority[v], -m_position[u]);
+            }
+            break;
+        }
+
+        return weight;
+    }
+
+    /*
+     * Returns the best pairing of the bracket with the current constraints that
+     * leaves the rest of the players pairable, or std::nullopt if none exists.
+     */
+    std::optional<Solution> solve()
+    {
+        ++m_solved;
+
+        m_graph.reset(m_vertices);
+        for (int u = 0; u < m_vertices; ++u) {
+            for (int v = u + 1; v < m_vertices; ++v) {
+                if (allowed(u, v)) {
+                    m_graph.addEdge(u, v, weight(u, v));
+                }
+            }
+        }
+        m_graph.build();
+
+        // Consecutive matchings of a bracket only differ in a few constraints
+        auto solution = collect(m_matching.resolve(m_graph));
+
+        std::vector<int> players;
+        for (int v = 0; v < m_vertices; ++v) {
+            if (solution.mates[v] < 0) {
+                players.push_back(m_players[v]);
+            }
+        }
+        const auto unpaired = static_cast<int>(players.size());
+        players.insert(players.end(), m_others.begin(), m_others.end());
+        if (m_context.isCompletable(players, unpaired)) {
+            return solution;
+        }
+
+        return solveAll();
+    }
+
+    /*
+     * Same as solve(), but pairing the rest of the players in the same matching.
+     */
+    std::optional<Solution> solveAll()
+    {
+        ++m_solved;
+
+        const auto &entries = m_context.entries();
+        const int others = static_cast<int>(m_others.size());
+        const int players = m_vertices + others;
+        const bool odd = players % 2 == 1;
+        const int vertices = players + (odd ? 1 : 0);
+
+        const auto position = [this](int v) {
+            return v < m_vertices ? m_players[v] : m_others[v - m_vertices];
+        };
+
+        LexicographicWeight pair;
+        m_layout.add(pair, m_cardinality, 1);
+
+        m_graph.reset(vertices);
+        for (int u = 0; u < players; ++u) {
+            const bool free = u >= m_vertices || m_forced[u] < 0;
+            for (int v = u + 1; v < players; ++v) {
+                if (v < m_vertices) {
+                    if (allowed(u, v)) {
+                        m_graph.addEdge(u, v, weight(u, v) + pair);
+                    }
+                } else if (free && m_context.compatible(position(u), position(v))) {
+                    m_graph.addEdge(u, v, pair);
+                }
+            }
+            if (odd && free && entries[position(u)].canGetBye) {
+                m_graph.addEdge(u, players, pair);
+            }
+        }
+        m_graph.build();
+
+        // The cardinality criterion comes first, so the matching has as many pairs
+        // as possible
+        const auto &mates = m_matching.solve(m_graph);
+        if (m_matching.size() * 2 != vertices) {
+            return std::nullopt;
+        }
+        return collect(mates);
+    }
+
+    [[nodiscard]] Solution collect(const std::vector<int> &mates) const
+    {
+        Solution solution;
+        solution.mates.assign(m_vertices, -1);
+        for (int v = 0; v < m_vertices; ++v) {
+            const int mate = mates[v];
+            if (mate >= 0 && mate < m_vertices) {
+                solution.mates[v] = mate;
+                if (mate > v) {
+                    solution.weight += weight(v, mate);
+                }
+            }
+        }
+        return solution;
+    }
+
+    [[nodiscard]] bool floats(const Solution &solution) const
+    {
+        for (int v = 0; v < m_bracket; ++v) {
+            if (solution.mates[v] < 0 || solution.mates[v] >= m_bracket) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*
+     * Solves the bracket with the current constraints, and keeps the solution if
+     * it is one of the best candidates.
+     */
+    bool tryConstraints()
+    {
+        auto solution = solve();
+        if (!solution || !m_layout.equal(solution->weight, m_target, m_pairs, m_quality - 1)) {
+            return false;
+        }
+        m_mates = std::move(solution->mates);
+        return true;
+    }
+
+    void force(int u, int v)
+    {
+        m_forced[u] = v;
+        m_forced[v] = u;
+    }
+
+    /*
+     * Pairs the moved down players: first the ones that are paired (D.3), and then
+     * their opponents among the residents.
+     */
+    void pairMdps()
+    {
+        if (m_mdps == 0) {
+            return;
+        }
+
+        int paired = 0;
+        for (int v = 0; v < m_mdps; ++v) {
+            paired += m_mates[v] >= m_mdps && m_mates[v] < m_bracket ? 1 : 0;
+        }
+
+        std::vector<int> s1;
+        std::vector<int> limbo;
+        for (int v = 0; v < m_mdps; ++v) {
+            (v < paired ? s1 : limbo).push_back(v);
+        }
+
+        if (paired > 0 && paired < m_mdps) {
+            for (int v = 0; v < m_mdps; ++v) {
+                m_rank[v] = v + 1;
+                m_second[v] = v >= paired;
+            }
+            const auto isPaired = [this](int v) {
+                return m_mates[v] >= m_mdps && m_mates[v] < m_bracket;
+            };
+            exchange(s1, limbo, Phase::MdpExchange, isPaired, [this](const std::vector<int> &, const std::vector<int> &others, bool known) {
+                for (const int v : others) {
+                    m_side[v] = Side::Limbo;
+                }
+                if (known || tryConstraints()) {
+                    return true;
+                }
+                for (const int v : others) {
+                    m_side[v] = Side::None;
+                }
+                return false;
+            });
+
+            s1.clear();
+            for (int v = 0; v < m_mdps; ++v) {
+                if (m_side[v] != Side::Limbo) {
+                    s1.push_back(v);
+                }
+            }
+        } else {
+            for (const int v : limbo) {
+                m_side[v] = Side::Limbo;
+            }
+        }
+
+        std::vector<int> s2(m_bracket - m_mdps);
+        std::iota(s2.begin(), s2.end(), m_mdps);
+        transpose(s1, s2);
+    }
+
+    /*
+     * Pairs the residents that are not paired with moved down players, as a
+     * homogeneous bracket: first the exchanges between S1 and S2 (D.2), and then
+     * the transpositions of S2 (D.1).
+     */
+    void pairRemainder()
+    {
+        std::vector<int> remainder;
+        for (int v = m_mdps; v < m_bracket; ++v) {
+            if (m_forced[v] < 0) {
+                remainder.push_back(v);
+            }
+        }
+
+        std::size_t pairs = 0;
+        for (const int v : remainder) {
+            pairs += m_mates[v] > v && m_mates[v] < m_bracket ? 1 : 0;
+        }
+        if (pairs == 0) {
+            return;
+        }
+
+        std::vector<int> s1;
+        std::vector<int> s2;
+        if (m_system == SwissPairingEngine::System::Dubov) {
+            splitByColor(remainder, pairs, s1, s2);
+        } else {
+            s1.assign(remainder.begin(), remainder.begin() + static_cast<std::ptrdiff_t>(pairs));
+            s2.assign(remainder.begin() + static_cast<std::ptrdiff_t>(pairs), remainder.end());
+        }
+
+        if (pairFirst(s1, s2)) {
+            return;
+        }
+
+        std::ranges::fill(m_rank, 0);
+        std::ranges::fill(m_second, false);
+        for (std::size_t i = 0; i < s1.size(); ++i) {
+            m_rank[s1[i]] = static_cast<int>(i) + 1;
+        }
+        for (std::size_t i = 0; i < s2.size(); ++i) {
+            m_rank[s2[i]] = static_cast<int>(s1.size() + i) + 1;
+            m_second[s2[i]] = true;
+        }
+        // The player of S1 stays in S1. With two players of S1, the lower one
+        // moves to S2, and with two players of S2 the higher one moves to S1.
+        const auto staysInS1 = [this](int v) {
+            const int mate = m_mates[v];
+            if (mate < 0 || mate >= m_bracket || m_rank[mate] == 0) {
+                return false;
+            }
+            if (m_second[v] != m_second[mate]) {
+                return !m_second[v];
+            }
+            return m_rank[v] < m_rank[mate];
+        };
+        exchange(s1, s2, Phase::Exchange, staysInS1, [this](const std::vector<int> &selected, const std::vector<int> &others, bool known) {
+            for (const int v : selected) {
+                m_side[v] = Side::S1;
+            }
+            for (const int v : others) {
+                m_side[v] = Side::S2;
+            }
+            if (known || tryConstraints()) {
+                return true;
+            }
+            for (const int v : selected) {
+                m_side[v] = Side::None;
+            }
+            for (const int v : others) {
+                m_side[v] = Side::None;
+            }
+            return false;
+        });
+
+        s1.clear();
+        s2.clear();
+        for (const int v : remainder) {
+            (m_side[v] == Side::S1 ? s1 : s2).push_back(v);
+        }
+        if (!pairFirst(s1, s2)) {
+            order(s1, s2);
+            transpose(s1, s2);
+        }
+    }
+
+    /*
+     * Pairs the remainder with the first candidate of the exchange of  s1 and
+     *  s2 if it is one of the best candidates, which is usually the case.
+     */
+    bool pairFirst(std::vector<int> s1, std::vector<int> s2)
+    {
+        // The pairs of the next bracket are unknown
+        if (m_lookahead) {
+            return false;
+        }
+
+        order(s1, s2);
+
+        auto mates = m_forced;
+        for (const int player : s1) {
+            const auto opponent = std::ranges::find_if(s2, [&](int v) {
+                return mates[v] < 0 && allowed(player, v);
+            });
+            if (opponent == s2.end()) {
+                return false;
+            }
+            mates[player] = *opponent;
+            mates[*opponent] = player;
+        }
+
+        LexicographicWeight weight;
+        std::vector<int> players;
+        for (int v = 0; v < m_bracket; ++v) {
+            if (mates[v] < 0) {
+                players.push_back(m_players[v]);
+            } else if (mates[v] > v) {
+                weight += this->weight(v, mates[v]);
+            }
+        }
+        const auto unpaired = static_cast<int>(players.size());
+        players.insert(players.end(), m_others.begin(), m_others.end());
+        if (!m_layout.equal(weight, m_target, m_pairs, m_quality - 1) || !m_context.isCompletable(players, unpaired)) {
+            return false;
+        }
+
+        for (const int v : s1) {
+            m_side[v] = Side::S1;
+            force(v, mates[v]);
+        }
+        for (const int v : s2) {
+            m_side[v] = Side::S2;
+        }
+        m_mates = std::move(mates);
+        return true;
+    }
+
+    /*
+     * Finds the first exchange between \a s1 and \a s2 in the order of the Dutch
+     * system that keeps the best candidates, and applies it with \a apply. The
+     * number of players moved and the difference of their pairing numbers are
+     * taken from the solution that minimizes them with the criteria of \a phase,
+     * where \a selected tells the players that end in S1.
+     *
+     * Exchanges are ordered by the number of players moved, the difference of the
+     * sums of their pairing numbers, the highest different player moved from S1,
+     * and the lowest different player moved from S2.
+     */
+    template<typename Selected, typename Apply>
+    void exchange(const std::vector<int> &s1, const std::vector<int> &s2, Phase phase, Selected selected, Apply apply)
+    {
+        std::vector<int> knownOut;
+        std::vector<int> knownIn;
+        const auto findKnown = [&]() {
+            knownOut.clear();
+            knownIn.clear();
+            for (const int v : s1) {
+                if (!selected(v)) {
+                    knownOut.push_back(v);
+                }
+            }
+            for (const int v : s2) {
+                if (selected(v)) {
+                    knownIn.push_back(v);
+                }
+            }
+            Q_ASSERT(knownOut.size() == knownIn.size());
+        };
+
+        // The first exchange is usually possible, without moving any player
+        findKnown();
+        if (knownOut.empty()) {
+            apply(s1, s2, true);
+            return;
+        }
+        if (apply(s1, s2, false)) {
+            return;
+        }
+
+        // Otherwise, the solution with the smallest exchange tells its size and
+        // difference of pairing numbers
+        setPhase(phase);
+        tryConstraints();
+        setPhase(Phase::Quality);
+        findKnown();
+
+        const auto size = static_cast<int>(knownOut.size());
+        int difference = 0;
+        for (const int v : knownIn) {
+            difference += m_rank[v];
+        }
+        for (const int v : knownOut) {
+            difference -= m_rank[v];
+        }
+
+        std::vector<int> out;
+        std::vector<int> in;
+
+        const auto visit = [&]() {
+            std::vector<int> newS1;
+            std::vector<int> newS2;
+            for (const int v : s1) {
+                (std::ranges::find(out, v) == out.end() ? newS1 : newS2).push_back(v);
+            }
+            for (const int v : s2) {
+                (std::ranges::find(in, v) == in.end() ? newS2 : newS1).push_back(v);
+            }
+
+            const bool known = out == knownOut && in == knownIn;
+            if (!known) {
+                // Every player of S1 needs a possible opponent in S2
+                for (const int a : newS1) {
+                    if (std::ranges::none_of(newS2, [&](int b) {
+                            return allowed(a, b);
+                        })) {
+                        return false;
+                    }
+                }
+            }
+            return apply(newS1, newS2, known);
+        };
+
+        // Players moved from S2, from the lowest pairing number
+        const auto searchIn = [&](auto &self, std::size_t begin, int remaining, int sum) -> bool {
+            if (remaining == 0) {
+                return sum == 0 && visit();
+            }
+            for (auto j = begin; j + remaining <= s2.size(); ++j) {
+                const int rank = m_rank[s2[j]];
+                if (rank * remaining > sum) {
+                    break;
+                }
+                if (remaining == 1 && rank != sum) {
+                    continue;
+                }
+                in.push_back(s2[j]);
+                const bool found = self(self, j + 1, remaining - 1, sum - rank);
+                in.pop_back();
+                if (found) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        // Players moved from S1, from the highest pairing number
+        const auto searchOut = [&](auto &self, std::size_t end, int remaining, int sum) -> bool {
+            if (remaining == 0) {
+                return searchIn(searchIn, 0, size, sum + difference);
+            }
+            for (auto i = end; i-- > static_cast<std::size_t>(remaining - 1);) {
+                out.push_back(s1[i]);
+                const bool found = self(self, i, remaining - 1, sum + m_rank[s1[i]]);
+                out.pop_back();
+                if (found) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        std::ranges::sort(knownOut, std::greater{}, [this](int v) {
+            return m_rank[v];
+        });
+        std::ranges::sort(knownIn, {}, [this](int v) {
+            return m_rank[v];
+        });
+
+        [[maybe_unused]] const bool found = searchOut(searchOut, s1.size(), size, 0);
+        Q_ASSERT(found);
+    }
+
+    /*
+     * Pairs every player of \a s1 with the first player of \a s2 that keeps the
+     * best candidates (D.1).
+     */
+    void transpose(const std::vector<int> &s1, const std::vector<int> &s2)
+    {
+        std::ranges::fill(m_position, -1);
+        for (std::size_t i = 0; i < s2.size(); ++i) {
+            m_position[s2[i]] = static_cast<int>(i);
+        }
+        m_s2Size = static_cast<int>(s2.size());
+
+        for (std::size_t i = 0; i < s1.size();) {
+            // The current solution pairs the player with the first opponent
+            // available
+            const int player = s1[i];
+            const auto opponent = std::ranges::find_if(s2, [&](int v) {
+                return allowed(player, v);
+            });
+            if (opponent != s2.end() && m_mates[player] == *opponent) {
+                force(player, *opponent);
+                ++i;
+                continue;
+            }
+
+            // Or swapping two pairs of the current solution does
+            if (opponent != s2.end() && swap(player, *opponent)) {
+                force(player, *opponent);
+                ++i;
+                continue;
+            }
+
+            // Or some other solution does
+            if (opponent != s2.end()) {
+                force(player, *opponent);
+                if (tryConstraints()) {
+                    ++i;
+                    continue;
+                }
+                m_forced[player] = -1;
+                m_forced[*opponent] = -1;
+            }
+
+            // Otherwise, the positions of the opponents are minimized in order,
+            // for as many players as fit in the weights
+            m_transposed.assign(s1.begin() + static_cast<std::ptrdiff_t>(i), s1.end());
+            setPhase(Phase::Transposition);
+            [[maybe_unused]] const bool solved = tryConstraints();
+            Q_ASSERT(solved);
+
+            for (; i < s1.size() && m_layout.fits(m_priority[s1[i]]); ++i) {
+                const int mate = m_mates[s1[i]];
+                if (mate >= 0 && m_position[mate] >= 0) {
+                    force(s1[i], mate);
+                }
+            }
+        }
+
+        m_transposed.clear();
+        std::ranges::fill(m_priority, -1);
+        setPhase(Phase::Quality);
+    }
+
+    /*
+     * Changes the current solution to pair \a player with \a opponent, pairing
+     * their current opponents with each other, if the solution is still one of
+     * the best candidates.
+     */
+    bool swap(int player, int opponent)
+    {
+        const int a = m_mates[player];
+        const int b = m_mates[opponent];
+        if (b == player || (a >= 0 && b >= 0 && !allowed(a, b))) {
+            return false;
+        }
+
+        auto before = a >= 0 ? weight(player, a) : LexicographicWeight{};
+        if (b >= 0) {
+            before += weight(opponent, b);
+        }
+        auto after = weight(player, opponent);
+        if (a >= 0 && b >= 0) {
+            after += weight(a, b);
+        }
+        if (!m_layout.equal(before, after, m_pairs, m_quality - 1)) {
+            return false;
+        }
+
+        auto mates = m_mates;
+        mates[player] = opponent;
+        mates[opponent] = player;
+        if (a >= 0) {
+            mates[a] = b;
+        }
+        if (b >= 0) {
+            mates[b] = a;
+        }
+
+        // The unpaired players change
+        if (a < 0 || b < 0) {
+            std::vector<int> players;
+            for (int v = 0; v < m_vertices; ++v) {
+                if (mates[v] < 0) {
+                    players.push_back(m_players[v]);
+                }
+            }
+            const auto unpaired = static_cast<int>(players.size());
+            players.insert(players.end(), m_others.begin(), m_others.end());
+            if (!m_context.isCompletable(players, unpaired)) {
+                return false;
+            }
+        }
+
+        m_mates = std::move(mates);
+        return true;
+    }
+
+    /*
+     * Sorts \a s1 and \a s2 in the order their players are paired.
+     */
+    void order(std::vector<int> &s1, std::vector<int> &s2) const
+    {
+        sortS1(s1);
+        sortS2(s2);
+        // Burstein pairs the first player of S1 against the last player of S2
+        if (m_system == SwissPairingEngine::System::Burstein) {
+            std::ranges::reverse(s2);
+        }
+    }
+
+    void sortS1(std::vector<int> &players) const
+    {
+        if (m_system == SwissPairingEngine::System::Dubov) {
+            // Ascending average rating of opponents, then descending rating
+            std::ranges::sort(players, [this](int a, int b) {
+                const auto &x = entry(a);
+                const auto &y = entry(b);
+                if (x.averageOpponentRating != y.averageOpponentRating) {
+                    return x.averageOpponentRating < y.averageOpponentRating;
+                }
+                if (x.rating != y.rating) {
+                    return x.rating > y.rating;
+                }
+                return a < b;
+            });
+            return;
+        }
+        std::ranges::sort(players);
+    }
+
+    void sortS2(std::vector<int> &players) const
+    {
+        if (m_system == SwissPairingEngine::System::Dubov) {
+            // Descending rating
+            std::ranges::sort(players, [this](int a, int b) {
+                const auto &x = entry(a);
+                const auto &y = entry(b);
+                if (x.rating != y.rating) {
+                    return x.rating > y.rating;
+                }
+                return a < b;
+            });
+            return;
+        }
+        std::ranges::sort(players);
+    }
+
+    /*
+     * Splits \a players into white seekers (S1) and black seekers (S2), as in the
+     * Dubov system. If the groups have different sizes, the players with the
+     * weakest preference move to the smaller group.
+     */
+    void splitByColor(const std::vector<int> &players, std::size_t size, std::vector<int> &s1, std::vector<int> &s2) const
+    {
+        // Without color history, e.g. in the first round, the bracket is split in halves
+        if (std::ranges::all_of(players, [this](int v) {
+                return entry(v).preference == Pairing::Color::Unknown;
+            })) {
+            s1.assign(players.begin(), players.begin() + static_cast<std::ptrdiff_t>(size));
+            s2.assign(players.begin() + static_cast<std::ptrdiff_t>(size), players.end());
+            return;
+        }
+
+        for (const int v : players) {
+            const auto &e = entry(v);
+            auto color = e.preference;
+            if (color == Pairing::Color::Unknown) {
+                color = (e.player + 1) % 2 == 1 ? Pairing::Color::White : Pairing::Color::Black;
+            }
+            (color == Pairing::Color::White ? s1 : s2).push_back(v);
+        }
+
+        const auto weakest = [this](std::vector<int> &group) {
+            const auto it = std::ranges::min_element(group, [this](int a, int b) {
+                if (entry(a).strength != entry(b).strength) {
+                    return entry(a).strength < entry(b).strength;
+                }
+                return a > b;
+            });
+            const int player = *it;
+            group.erase(it);
+            return player;
+        };
+
+        while (s1.size() > size) {
+            s2.push_back(weakest(s1));
+        }
+        while (s1.size() < size) {
+            s1.push_back(weakest(s2));
+        }
+
+        sortS1(s1);
+        sortS2(s2);
+    }
+
+    const Context &m_context;
+    SwissPairingEngine::System m_system;
+    const std::vector<int> &m_mdpList;
+    const std::vector<int> &m_residentList;
+    const std::vector<int> &m_next;
+    const std::vector<int> &m_rest;
+    bool m_upwards;
+    long long &m_solved;
+
+    // Vertices of the matching: moved down players, residents and, with
+    // lookahead, the next bracket
+    const int m_mdps;
+    const int m_bracket;
+    int m_vertices = 0;
+    bool m_lookahead = false;
+    std::vector<int> m_players;
+
+    // Players paired after the matching
+    std::vector<int> m_others;
+
+    int m_artificial = 0;
+    int m_nextArtificial = 0;
+
+    WeightLayout m_layout;
+    int m_cardinality = -1;
+    int m_pairs = -1;
+    std::vector<int> m_psd;
+    int m_nextPairs = -1;
+    std::vector<int> m_nextPsd;
+    int m_byeUnplayed = -1;
+    int m_topscorerDifference = -1;
+    int m_topscorerRepeated = -1;
+    int m_preference = -1;
+    int m_strongPreference = -1;
+    std::array<int, 4> m_floats{};
+    std::array<int, 4> m_floatDifferences{};
+    int m_quality = 0;
+
+    // Generation order
+    Phase m_phase = Phase::Quality;
+    int m_exchangeSize = -1;
+    int m_exchangeDifference = -1;
+    std::vector<int> m_rank;
+    std::vector<char> m_second;
+    std::vector<int> m_transposed;
+    std::vector<int> m_priority;
+    std::vector<int> m_position;
+    int m_s2Size = 0;
+
+    // Constraints of the candidates
+    std::vector<int> m_forced;
+    std::vector<Side> m_side;
+
+    LexicographicWeight m_target;
+    std::vector<int> m_mates;
+
+    LexicographicMatchingGraph m_graph;
+    LexicographicMatching m_matching;
+};
+
+}
+
+SwissPairingEngine::SwissPairingEngine(System system)
+    : m_system(system)
+{
+}
+
+SwissPairingEngine::System SwissPairingEngine::system() const
+{
+    return m_system;
+}
+
+std::optional<SwissPairingEngine::Pairs> SwissPairingEngine::pair(const PairingSnapshot &snapshot)
+{
+    m_solvedMatchings = 0;
+
+    const Context context{snapshot};
+    const auto &entries = context.entries();
+    const int n = static_cast<int>(entries.size());
+
+    Pairs result;
+    if (n == 0) {
+        return result;
+    }
+    result.reserve(n / 2 + 1);
+
+    std::vector<int> all(n);
+    std::iota(all.begin(), all.end(), 0);
+    if (!context.isCompletable(all)) {
+        return std::nullopt;
+    }
+
+    const auto addPair = [&](int a, int b) {
+        if (b < 0) {
+            result.emplace_back(entries[a].player, -1);
+            return;
+        }
+        const auto [white, black] = context.allocateColors(a, b);
+        result.emplace_back(entries[white].player, entries[black].player);
+    };
+
+    // Score groups, as ranges of positions
+    std::vector<std::pair<int, int>> groups;
+    for (int begin = 0; begin < n;) {
+        int end = begin;
+        while (end < n && entries[end].score == entries[begin].score) {
+            ++end;
+        }
+        groups.emplace_back(begin, end);
+        begin = end;
+    }
+    const int numberOfGroups = static_cast<int>(groups.size());
+
+    // Order in which the score groups are paired. Lim pairs towards the median
+    // group, which is the one closest to half of the maximum score.
+    std::vector<int> order(numberOfGroups);
+    std::iota(order.begin(), order.end(), 0);
+    int median = numberOfGroups - 1;
+    if (m_system == System::Lim) {
+        const auto half = snapshot.playedRounds();
+        median = 0;
+        for (int g = 1; g < numberOfGroups; ++g) {
+            if (std::abs(entries[groups[g].first].score - half) <= std::abs(entries[groups[median].first].score - half)) {
+                median = g;
+            }
+        }
+        order.clear();
+        for (int g = 0; g < median; ++g) {
+            order.push_back(g);
+        }
+        for (int g = numberOfGroups - 1; g > median; --g) {
+            order.push_back(g);
+        }
+        order.push_back(median);
+    }
+
+    // Burstein sorts by rating during the seeding rounds
+    const int seedingRounds = std::min(snapshot.numberOfRounds() / 2, 4);
+
+    std::vector<char> paired(numberOfGroups, false);
+    std::vector<int> movedDown;
+    std::vector<int> movedUp;
+    std::vector<int> mdps;
+    std::vector<int> residents;
+    std::vector<int> next;
+    std::vector<int> remaining;
+
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        const int g = order[i];
+        const bool last = i + 1 == order.size();
+        const bool upwards = m_system == System::Lim && g > median;
+
+        residents.resize(groups[g].second - groups[g].first);
+        std::iota(residents.begin(), residents.end(), groups[g].first);
+
+        if (m_system == System::Burstein && snapshot.playedRounds() >= seedingRounds) {
+            // Sorting index: Buchholz, then Sonneborn-Berger
+            std::ranges::stable_sort(residents, [&entries](int a, int b) {
+                if (entries[a].buchholz != entries[b].buchholz) {
+                    return entries[a].buchholz > entries[b].buchholz;
+                }
+                return entries[a].sonnebornBerger > entries[b].sonnebornBerger;
+            });
+        }
+
+        if (last) {
+            mdps = movedDown;
+            mdps.insert(mdps.end(), movedUp.begin(), movedUp.end());
+            std::ranges::sort(mdps);
+        } else {
+            mdps = upwards ? movedUp : movedDown;
+        }
+
+        // The choice of floaters also depends on the next bracket, unless it is
+        // the last one (C.7)
+        next.clear();
+        if (m_system == System::Dutch && i + 2 < order.size()) {
+            const auto [begin, end] = groups[order[i + 1]];
+            next.resize(end - begin);
+            std::iota(next.begin(), next.end(), begin);
+        }
+
+        paired[g] = true;
+        remaining = upwards ? movedDown : movedUp;
+        if (last) {
+            remaining.clear();
+        }
+        for (int h = 0; h < numberOfGroups; ++h) {
+            if (!paired[h] && (next.empty() || h != order[i + 1])) {
+                for (int p = groups[h].first; p < groups[h].second; ++p) {
+                    remaining.push_back(p);
+                }
+            }
+        }
+
+        BracketPairing bracket{context, m_system, mdps, residents, next, remaining, upwards, m_solvedMatchings};
+        auto candidate = bracket.run();
+        if (!candidate) {
+            return std::nullopt;
+        }
+
+        for (const auto &[a, b] : candidate->pairs) {
+            addPair(a, b);
+        }
+
+        if (last) {
+            mdps = std::move(candidate->floaters);
+        } else if (upwards) {
+            movedUp = std::move(candidate->floaters);
+        } else {
+            movedDown = std::move(candidate->floaters);
+        }
+    }
+
+    if (mdps.size() > 1) {
+        return std::nullopt;
+    }
+    if (mdps.size() == 1) {
+        addPair(mdps.front(), -1);
+    }
+
+    return result;
+}
+
+long long SwissPairingEngine::solvedMatchings() const
+{
+    return m_solvedMatchings;
+}
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+class PairingSnapshot;
+
+/*!
+ * \class SwissPairingEngine
+ * \inmodule tournament
+ * \inheaderfile tournament/pairings/swiss.h
+ *
+ * \brief In-process implementation of the FIDE Swiss systems.
+ *
+ * Brackets are paired one score group at a time. The quality criteria of C.04.3
+ * are encoded as the components of lexicographic edge weights, so a maximum weight
+ * matching of a bracket is always one of its best pairings, including the
+ * condition that the remaining players can still be paired. Among the best
+ * pairings, the one that comes first in the order given by the system is chosen
+ * by fixing its pairs one at a time, so the result is exact and doesn't depend on
+ * the number of candidates a bracket has.
+ */
+class SwissPairingEngine
+{
+public:
+    /*!
+     * \enum SwissPairingEngine::System
+     *
+     * \value Dutch Dutch system (C.04.3). S1 is paired against S2 in order.
+     * \value Burstein Burstein system (C.04.4.2). Players in a bracket are sorted
+     * by their Buchholz and Sonneborn-Berger, and the first player is paired
+     * against the last one.
+     * \value Dubov Dubov system (C.04.4.1). White seekers, sorted by their average
+     * rating of opponents, are paired against black seekers, sorted by rating.
+     * \value Lim Lim system (C.04.4.3). Score groups are paired from the top and
+     * from the bottom towards the median group, which is paired last.
+     */
+    enum class System {
+        Dutch,
+        Burstein,
+        Dubov,
+        Lim,
+    };
+
+    using Pairs = std::vector<std::pair<int, int>>;
+
+    explicit SwissPairingEngine(System system = System::Dutch);
+
+    [[nodiscard]] System system() const;
+
+    /*!
+     * Returns the pairings for the next round of \a snapshot.
+     *
+     * Each pair contains the index of the player with white and the index of the
+     * player with black. The player receiving the pairing-allocated bye is paired
+     * with -1.
+     *
+     * Returns std::nullopt if no valid pairing exists.
+     */
+    [[nodiscard]] std::optional<Pairs> pair(const PairingSnapshot &snapshot);
+
+    /*!
+     * Returns the number of matchings solved by the last call to pair().
+     */
+    [[nodiscard]] long long solvedMatchings() const;
+
+private:
+    System m_system;
+    long long m_solvedMatchings = 0;
+};
@@ -23,8 +23,38 @@ FormCard.FormCardPage {
         title: KI18n.i18nc("@title:group", "Format")
     }
     FormCard.FormCard {
-        FormCard.FormTextDelegate {
-            text: KI18n.i18n("Swiss system")
+        FormCard.FormComboBoxDelegate {
+            text: KI18n.i18nc("@label:listbox", "Pairing system")
+            textRole: "text"
+            valueRole: "value"
+            model: [
+                {
+                    value: Tournament.PairingSystem.Dutch,
+                    text: KI18n.i18nc("@item:inlistbox", "Swiss system (FIDE Dutch)")
+                },
+                {
+                    value: Tournament.PairingSystem.Burstein,
+                    text: KI18n.i18nc("@item:inlistbox", "Swiss system (FIDE Burstein)")
+                },
+                {
+                    value: Tournament.PairingSystem.Dubov,
+                    text: KI18n.i18nc("@item:inlistbox", "Swiss system (FIDE Dubov)")
+                },
+                {
+                    value: Tournament.PairingSystem.Lim,
+                    text: KI18n.i18nc("@item:inlistbox", "Swiss system (FIDE Lim)")
+                },
+                {
+                    value: Tournament.PairingSystem.RoundRobin,
+                    text: KI18n.i18nc("@item:inlistbox", "Round-robin")
+                },
+                {
+                    value: Tournament.PairingSystem.DoubleRoundRobin,
+                    text: KI18n.i18nc("@item:inlistbox", "Double round-robin")
+                }
+            ]
+            Component.onCompleted: currentIndex = indexOfValue(root.tournament.pairingSystem)
+            onActivated: root.tournament.pairingSystem = currentValue
         }
 
         FormCard.FormSpinBoxDelegate {
@@ -45,10 +75,77 @@ FormCard.FormCardPage {
         title: KI18n.i18nc("@title:group", "Pairings")
     }
     FormCard.FormCard {
-        FormCard.FormLinkDelegate {
-            text: KI18n.i18n("Pairing engine")
-            description: KI18n.i18n("bbpPairings")
-            url: "https://github.com/BieremaBoyzProgramming/bbpPairings"
+        FormCard.FormComboBoxDelegate {
+            id: pairingEngine
+            text: KI18n.i18nc("@label:listbox", "Pairing engine")
+            textRole: "text"
+            valueRole: "value"
+            model: [
+                {
+                    value: Tournament.PairingEngine.BuiltIn,
+                    text: KI18n.i18nc("@item:inlistbox", "Built-in")
+                },
+                {
+                    value: Tournament.PairingEngine.BbpPairings,
+                    text: KI18n.i18nc("@item:inlistbox bbpPairings is the name of a program, should not be translated", "bbpPairings (Dutch and Burstein only)")
+                }
+            ]
+            Component.onCompleted: currentIndex = indexOfValue(root.tournament.pairingEngine)
+            onActivated: root.tournament.pairingEngine = currentValue
+        }
+
+        FormCard.FormDelegateSeparator {
+            visible: crossCheck.visible
+        }
+
+        FormCard.FormSwitchDelegate {
+            id: crossCheck
+            visible: root.tournament.pairingEngine === Tournament.PairingEngine.BuiltIn
+            text: KI18n.i18nc("@option:check", "Cross-check with bbpPairings")
+            description: KI18n.i18nc("@info bbpPairings is the name of a program, should not be translated", "Compare the pairings with the ones generated by bbpPairings and log any difference.")
+            checked: root.tournament.crossCheckPairings
+            onToggled: root.tournament.crossCheckPairings = checked
+        }
+
+        FormCard.FormDelegateSeparator {
+            visible: speculativePairing.visible
+        }
+
+        FormCard.FormSwitchDelegate {
+            id: speculativePairing
+            visible: root.tournament.pairingEngine === Tournament.PairingEngine.BuiltIn
+            text: KI18n.i18nc("@option:check", "Pair next round in advance")
+            description: KI18n.i18nc("@info", "When only a few games are still being played, compute the pairings of the next round for every possible result.")
+            checked: root.tournament.speculativePairing
+            onToggled: root.tournament.speculativePairing = checked
+        }
+
+        FormCard.FormSpinBoxDelegate {
+            visible: speculativePairing.visible && speculativePairing.checked
+            label: KI18n.i18nc("@label:spinbox", "Threads")
+            from: 1
+            to: 64
+            value: root.tournament.speculativePairingThreads
+            onValueChanged: {
+                if (root.tournament.speculativePairingThreads === value) {
+                    return;
+                }
+                root.tournament.speculativePairingThreads = value;
+            }
+        }
+
+        FormCard.FormSpinBoxDelegate {
+            visible: speculativePairing.visible && speculativePairing.checked
+            label: KI18n.i18nc("@label:spinbox", "Maximum result combinations")
+            from: 1
+            to: 6561
+            value: root.tournament.speculativePairingScenarios
+            onValueChanged: {
+                if (root.tournament.speculativePairingScenarios === value) {
+                    return;
+                }
+                root.tournament.speculativePairingScenarios = value;
+            }
         }
     }
 
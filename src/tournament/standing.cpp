@@ -3,10 +3,19 @@
 
 #include "standing.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include "player.h"
+
 Standing::Standing(Player *player, std::vector<double> values)
     : m_player(player)
     , m_values(std::move(values))
 {
+    m_key.reserve(static_cast<qsizetype>(m_values.size()));
+    for (const auto value : m_values) {
+        m_key.append(quantize(value));
+    }
 }
 
 int Standing::rank() const
@@ -19,11 +28,16 @@ Player *Standing::player() const
     return m_player;
 }
 
-std::vector<double> Standing::values() const
+const std::vector<double> &Standing::values() const
 {
     return m_values;
 }
 
+const Standing::Key &Standing::key() const
+{
+    return m_key;
+}
+
 void Standing::setRank(int rank)
 {
     m_rank = rank;
@@ -32,4 +46,23 @@ void Standing::setRank(int rank)
 void Standing::addValue(double value)
 {
     m_values.push_back(value);
+    m_key.append(quantize(value));
+}
+
+bool Standing::isBefore(const Standing &a, const Standing &b)
+{
+    if (a.m_key != b.m_key) {
+        return std::ranges::lexicographical_compare(b.m_key, a.m_key);
+    }
+    return a.m_player->startingRank() < b.m_player->startingRank();
+}
+
+Standing::Key::value_type Standing::quantize(double value)
+{
+    const auto key = static_cast<Key::value_type>(std::llround(value * KeyScale));
+
+    // Two values must be equal if and only if their keys are equal
+    Q_ASSERT(std::abs(value * KeyScale - static_cast<double>(key)) < 1e-6);
+
+    return key;
 }
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <QVarLengthArray>
+
+#include <cstdint>
 #include <vector>
 
 class Player;
@@ -10,17 +13,31 @@ class Player;
 class Standing
 {
 public:
+    // Values of the tiebreaks in hundredths, so standings can be sorted and compared
+    // with integer comparisons. Tiebreak values are multiples of 0.01.
+    using Key = QVarLengthArray<std::int32_t, 6>;
+
+    static constexpr int KeyScale = 100;
+
     explicit Standing(Player *player, std::vector<double> values);
 
     [[nodiscard]] int rank() const;
     [[nodiscard]] Player *player() const;
-    [[nodiscard]] std::vector<double> values() const;
+    [[nodiscard]] const std::vector<double> &values() const;
+    [[nodiscard]] const Key &key() const;
 
     void setRank(int rank);
     void addValue(double value);
 
+    // Returns whether a goes before b in the standings: higher values first, then
+    // lower starting rank
+    [[nodiscard]] static bool isBefore(const Standing &a, const Standing &b);
+
+    [[nodiscard]] static Key::value_type quantize(double value);
+
 private:
     int m_rank = 1;
     Player *m_player;
     std::vector<double> m_values;
+    Key m_key;
 };
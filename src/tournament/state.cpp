@@ -3,62 +3,518 @@
 
 #include "state.h"
 
+#include <QSharedData>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+class State::Data : public QSharedData
+{
+public:
+    void set(int player, int round, Pairing *pairing);
+
+    // Updates the values after each round of the row of player
+    void accumulate(int player);
+
+    [[nodiscard]] std::size_t cell(int player, int round) const
+    {
+        return static_cast<std::size_t>(player) * static_cast<std::size_t>(rounds) + static_cast<std::size_t>(round);
+    }
+
+    int rounds = 0;
+    int numberOfPlayers = 0;
+
+    std::vector<Player *> players;
+    std::vector<int> ratings;
+
+    // One element per player and round
+    std::vector<Pairing *> pairings;
+    std::vector<int> opponents;
+    std::vector<Pairing::Color> colors;
+    std::vector<Pairing::PartialResult> results;
+    std::vector<double> points;
+
+    // Values after each round
+    std::vector<double> cumulativePoints;
+    std::vector<double> tiebreakPoints;
+    std::vector<int> whiteGames;
+    std::vector<int> blackGames;
+};
+
+class State::Cache
+{
+public:
+    explicit Cache(int numberOfPlayers)
+        : buchholz(numberOfPlayers)
+    {
+        for (auto &value : buchholz) {
+            value.store(NotComputed, std::memory_order_relaxed);
+        }
+    }
+
+    static constexpr double NotComputed = std::numeric_limits<double>::quiet_NaN();
+
+    // Two threads may compute the same value, but they store the same result
+    std::vector<std::atomic<double>> buchholz;
+
+    // One element per player and round of the view
+    std::once_flag opponentScoresFlag;
+    std::vector<double> opponentScores;
+    std::once_flag foreOpponentScoresFlag;
+    std::vector<double> foreOpponentScores;
+};
+
+void State::Data::set(int player, int round, Pairing *pairing)
+{
+    const auto i = cell(player, round);
+    const auto p = players[player];
+
+    pairings[i] = pairing;
+    results[i] = pairing->resultOfPlayer(p);
+    points[i] = Pairing::pointsForResult(results[i]);
+
+    if (const auto opponent = pairing->opponent(p); opponent != nullptr) {
+        opponents[i] = State::index(opponent);
+        colors[i] = pairing->colorOfPlayer(p);
+    } else {
+        opponents[i] = -1;
+        colors[i] = Pairing::Color::Unknown;
+    }
+}
+
+void State::Data::accumulate(int player)
+{
+    double total = 0.;
+    int white = 0;
+    int black = 0;
+
+    for (int round = 0; round < rounds; ++round) {
+        const auto i = cell(player, round);
+
+        total += points[i];
+        cumulativePoints[i] = total;
+
+        if (!Pairing::isUnplayed(results[i])) {
+            white += colors[i] == Pairing::Color::White ? 1 : 0;
+            black += colors[i] == Pairing::Color::Black ? 1 : 0;
+        }
+        whiteGames[i] = white;
+        blackGames[i] = black;
+
+        // Unplayed rounds at the end are scored differently, so the points for
+        // tiebreaks are computed backwards from each round
+        double tiebreak = 0.;
+        bool hadVUR = false;
+        bool last = true;
+        for (int r = round; r >= 0; --r) {
+            const auto j = cell(player, r);
+            if (pairings[j] == nullptr) {
+                continue;
+            }
+
+            const auto result = results[j];
+            if (Pairing::isUnplayed(result)) {
+                if (Pairing::isRequestedBye(result) && (hadVUR || last)) {
+                    tiebreak += .5;
+                    hadVUR = true;
+                } else {
+                    tiebreak += points[j];
+                    if (last) {
+                        hadVUR = Pairing::isVUR(result);
+                    } else {
+                        hadVUR &= Pairing::isVUR(result);
+                    }
+                }
+            } else {
+                tiebreak += points[j];
+                hadVUR = false;
+            }
+            last = false;
+        }
+        tiebreakPoints[i] = tiebreak;
+    }
+}
+
 State::State(Tournament *tournament, std::optional<int> maxRound)
-    : m_tournament(tournament)
+    : d(new Data)
 {
     if (!maxRound) {
-        m_maxRound = m_tournament->numberOfRounds();
+        m_maxRound = tournament->numberOfRounds();
     } else {
         m_maxRound = *maxRound;
     }
+    d->rounds = m_maxRound;
+
+    const auto players = tournament->players();
+    for (const auto player : players) {
+        d->numberOfPlayers = std::max(d->numberOfPlayers, player->startingRank());
+    }
+
+    d->players.resize(d->numberOfPlayers, nullptr);
+    d->ratings.resize(d->numberOfPlayers, 0);
+    for (const auto player : players) {
+        d->players[index(player)] = player;
+        d->ratings[index(player)] = player->rating();
+    }
 
-    m_pairingsByPlayer = m_tournament->pairingsByPlayer(m_maxRound);
+    const auto size = static_cast<std::size_t>(d->numberOfPlayers) * static_cast<std::size_t>(d->rounds);
+    d->pairings.resize(size, nullptr);
+    d->opponents.resize(size, -1);
+    d->colors.resize(size, Pairing::Color::Unknown);
+    d->results.resize(size, Pairing::PartialResult::Unknown);
+    d->points.resize(size, 0.);
+    d->cumulativePoints.resize(size, 0.);
+    d->tiebreakPoints.resize(size, 0.);
+    d->whiteGames.resize(size, 0);
+    d->blackGames.resize(size, 0);
+
+    for (int round = 0; round < d->rounds; ++round) {
+        const auto pairings = tournament->pairings(round + 1);
+        for (const auto pairing : pairings) {
+            d->set(index(pairing->whitePlayer()), round, pairing);
+            if (pairing->blackPlayer() != nullptr) {
+                d->set(index(pairing->blackPlayer()), round, pairing);
+            }
+        }
+    }
+
+    for (int player = 0; player < d->numberOfPlayers; ++player) {
+        d->accumulate(player);
+    }
+
+    m_cache = std::make_shared<Cache>(d->numberOfPlayers);
 }
 
+State::State(const State &other) = default;
+State::State(State &&other) noexcept = default;
+State::~State() = default;
+
+State &State::operator=(const State &other) = default;
+State &State::operator=(State &&other) noexcept = default;
+
 int State::lastRound() const
 {
     return m_maxRound;
 }
 
-QList<Pairing *> State::pairings(Player *player) const
+State State::cutOff(int maxRound) const
+{
+    Q_ASSERT(maxRound >= 0 && maxRound <= m_maxRound);
+
+    State state = *this;
+    state.m_maxRound = maxRound;
+    state.m_cache = std::make_shared<Cache>(d->numberOfPlayers);
+    return state;
+}
+
+int State::numberOfPlayers() const
+{
+    return d->numberOfPlayers;
+}
+
+int State::index(const Player *player)
+{
+    return player->startingRank() - 1;
+}
+
+Player *State::player(int index) const
+{
+    return d->players[index];
+}
+
+int State::rating(int player) const
+{
+    return d->ratings[player];
+}
+
+Pairing *State::pairing(int player, int round) const
+{
+    return d->pairings[cell(player, round)];
+}
+
+bool State::hasPairing(int player, int round) const
+{
+    return d->pairings[cell(player, round)] != nullptr;
+}
+
+std::optional<int> State::round(Pairing *pairing) const
+{
+    const auto white = index(pairing->whitePlayer());
+    if (white < 0 || white >= d->numberOfPlayers) {
+        return std::nullopt;
+    }
+
+    for (int round = 0; round < m_maxRound; ++round) {
+        if (d->pairings[cell(white, round)] == pairing) {
+            return round;
+        }
+    }
+
+    return std::nullopt;
+}
+
+int State::opponent(int player, int round) const
+{
+    return d->opponents[cell(player, round)];
+}
+
+Pairing::Color State::color(int player, int round) const
+{
+    return d->colors[cell(player, round)];
+}
+
+Pairing::PartialResult State::result(int player, int round) const
+{
+    return d->results[cell(player, round)];
+}
+
+double State::points(int player, int round) const
+{
+    return d->points[cell(player, round)];
+}
+
+double State::points(int player) const
+{
+    if (m_maxRound == 0) {
+        return 0.;
+    }
+    return d->cumulativePoints[cell(player, m_maxRound - 1)];
+}
+
+double State::pointsForTiebreaks(int player) const
+{
+    if (m_maxRound == 0) {
+        return 0.;
+    }
+    return d->tiebreakPoints[cell(player, m_maxRound - 1)];
+}
+
+int State::gamesWithWhite(int player) const
+{
+    if (m_maxRound == 0) {
+        return 0;
+    }
+    return d->whiteGames[cell(player, m_maxRound - 1)];
+}
+
+int State::gamesWithBlack(int player) const
 {
-    return m_pairingsByPlayer.value(player);
+    if (m_maxRound == 0) {
+        return 0;
+    }
+    return d->blackGames[cell(player, m_maxRound - 1)];
 }
 
-double State::points(Player *player) const
+double State::opponentScore(int player, int round) const
 {
-    const auto pairings = m_pairingsByPlayer.value(player);
+    std::call_once(m_cache->opponentScoresFlag, [this]() {
+        auto &scores = m_cache->opponentScores;
+        scores.resize(static_cast<std::size_t>(d->numberOfPlayers) * static_cast<std::size_t>(m_maxRound), 0.);
 
-    const auto points = std::accumulate(pairings.constBegin(), pairings.constEnd(), 0., [&player](double acc, Pairing *pairing) {
-        return acc + pairing->pointsOfPlayer(player);
+        for (int p = 0; p < d->numberOfPlayers; ++p) {
+            for (int r = 0; r < m_maxRound; ++r) {
+                if (const auto opponent = d->opponents[cell(p, r)]; opponent >= 0) {
+                    scores[viewCell(p, r)] = pointsForTiebreaks(opponent);
+                }
+            }
+        }
     });
 
-    return points;
+    return m_cache->opponentScores[viewCell(player, round)];
 }
 
-double State::pointsForTiebreaks(Player *player) const
+double State::forePoints(int player) const
 {
-    double points = 0.;
-    bool hadVUR = false;
-    const auto pairings = m_pairingsByPlayer.value(player);
-    for (auto pairing = pairings.rbegin(), rend = pairings.rend(); pairing != rend; ++pairing) {
-        if (Pairing::isUnplayed((*pairing)->whiteResult())) {
-            if (Pairing::isRequestedBye((*pairing)->whiteResult()) && (hadVUR || pairing == pairings.rbegin())) {
-                points += .5;
-                hadVUR = true;
-            } else {
-                points += (*pairing)->pointsOfPlayer(player);
-                const auto result = (*pairing)->resultOfPlayer(player);
-                if (pairing == pairings.rbegin()) {
-                    hadVUR = Pairing::isVUR(result);
-                } else {
-                    hadVUR &= Pairing::isVUR(result);
+    if (m_maxRound == 0) {
+        return 0.;
+    }
+
+    const auto i = cell(player, m_maxRound - 1);
+    if (d->pairings[i] != nullptr && !Pairing::isUnplayed(d->results[i])) {
+        return d->cumulativePoints[i] - d->points[i] + .5;
+    }
+    return d->cumulativePoints[i];
+}
+
+double State::forePointsForTiebreaks(int player) const
+{
+    if (m_maxRound == 0) {
+        return 0.;
+    }
+
+    // A game played in the last round doesn't change how the rounds before it are
+    // scored, so only its points have to be replaced
+    const auto i = cell(player, m_maxRound - 1);
+    if (d->pairings[i] != nullptr && !Pairing::isUnplayed(d->results[i])) {
+        return d->tiebreakPoints[i] - d->points[i] + .5;
+    }
+    return d->tiebreakPoints[i];
+}
+
+double State::foreOpponentScore(int player, int round) const
+{
+    std::call_once(m_cache->foreOpponentScoresFlag, [this]() {
+        auto &scores = m_cache->foreOpponentScores;
+        scores.resize(static_cast<std::size_t>(d->numberOfPlayers) * static_cast<std::size_t>(m_maxRound), 0.);
+
+        for (int p = 0; p < d->numberOfPlayers; ++p) {
+            for (int r = 0; r < m_maxRound; ++r) {
+                if (const auto opponent = d->opponents[cell(p, r)]; opponent >= 0) {
+                    scores[viewCell(p, r)] = forePointsForTiebreaks(opponent);
                 }
             }
+        }
+    });
+
+    return m_cache->foreOpponentScores[viewCell(player, round)];
+}
+
+double State::buchholz(int player) const
+{
+    auto &cached = m_cache->buchholz[player];
+    if (const auto value = cached.load(std::memory_order_relaxed); !std::isnan(value)) {
+        return value;
+    }
+
+    double result = 0.;
+    for (int round = 0; round < m_maxRound; ++round) {
+        const auto i = cell(player, round);
+        if (d->pairings[i] == nullptr) {
+            continue;
+        }
+
+        if (Pairing::isUnplayed(d->results[i])) {
+            // 16.4: dummy opponent with the same points as the player
+            result += points(player);
         } else {
-            points += (*pairing)->pointsOfPlayer(player);
-            hadVUR = false;
+            result += opponentScore(player, round);
         }
     }
-    return points;
+
+    cached.store(result, std::memory_order_relaxed);
+    return result;
+}
+
+void State::precompute(Tiebreak::Aggregates aggregates) const
+{
+    if (m_maxRound == 0 || d->numberOfPlayers == 0) {
+        return;
+    }
+
+    if (aggregates.testFlag(Tiebreak::Aggregate::OpponentScores)) {
+        std::ignore = opponentScore(0, 0);
+    }
+
+    if (aggregates.testFlag(Tiebreak::Aggregate::ForeOpponentScores)) {
+        std::ignore = foreOpponentScore(0, 0);
+    }
+
+    if (aggregates.testFlag(Tiebreak::Aggregate::Buchholz)) {
+        for (int player = 0; player < d->numberOfPlayers; ++player) {
+            std::ignore = buchholz(player);
+        }
+    }
+}
+
+void State::precompute(Tiebreak::Aggregates aggregates, const State &previous) const
+{
+    if (d.constData() != previous.d.constData() || previous.m_maxRound != m_maxRound - 1) {
+        precompute(aggregates);
+        return;
+    }
+
+    if (aggregates.testFlag(Tiebreak::Aggregate::Buchholz)) {
+        const auto round = m_maxRound - 1;
+
+        std::vector<double> values(d->numberOfPlayers);
+        for (int player = 0; player < d->numberOfPlayers; ++player) {
+            values[player] = previous.buchholz(player);
+        }
+
+        for (int player = 0; player < d->numberOfPlayers; ++player) {
+            const auto gain = pointsForTiebreaks(player) - previous.pointsForTiebreaks(player);
+            const auto ownGain = points(player) - previous.points(player);
+            if (gain == 0. && ownGain == 0.) {
+                continue;
+            }
+
+            // The player is the opponent of its opponents of the earlier rounds, and
+            // its own dummy opponents have its points
+            for (int r = 0; r < round; ++r) {
+                const auto i = cell(player, r);
+                if (d->pairings[i] == nullptr) {
+                    continue;
+                }
+
+                if (Pairing::isUnplayed(d->results[i])) {
+                    values[player] += ownGain;
+                } else if (const auto opponent = d->opponents[i]; opponent >= 0) {
+                    values[opponent] += gain;
+                }
+            }
+        }
+
+        for (int player = 0; player < d->numberOfPlayers; ++player) {
+            const auto i = cell(player, round);
+            if (d->pairings[i] != nullptr) {
+                if (Pairing::isUnplayed(d->results[i])) {
+                    values[player] += points(player);
+                } else if (const auto opponent = d->opponents[i]; opponent >= 0) {
+                    values[player] += pointsForTiebreaks(opponent);
+                }
+            }
+
+            m_cache->buchholz[player].store(values[player], std::memory_order_relaxed);
+        }
+    }
+
+    precompute(aggregates);
+}
+
+bool State::update(Pairing *pairing)
+{
+    const auto round = this->round(pairing);
+    if (!round) {
+        return false;
+    }
+
+    // The pairing must also be in the row of the black player
+    const auto black = pairing->blackPlayer() != nullptr ? index(pairing->blackPlayer()) : -1;
+    if (pairing->blackPlayer() != nullptr && (black < 0 || black >= d->numberOfPlayers || pairing != this->pairing(black, *round))) {
+        return false;
+    }
+
+    const auto white = index(pairing->whitePlayer());
+    d->set(white, *round, pairing);
+    d->accumulate(white);
+
+    if (black >= 0) {
+        d->set(black, *round, pairing);
+        d->accumulate(black);
+    }
+
+    m_cache = std::make_shared<Cache>(d->numberOfPlayers);
+
+    return true;
+}
+
+std::size_t State::cell(int player, int round) const
+{
+    Q_ASSERT(player >= 0 && player < d->numberOfPlayers);
+    Q_ASSERT(round >= 0 && round < m_maxRound);
+
+    return d->cell(player, round);
+}
+
+std::size_t State::viewCell(int player, int round) const
+{
+    Q_ASSERT(player >= 0 && player < d->numberOfPlayers);
+    Q_ASSERT(round >= 0 && round < m_maxRound);
+
+    return static_cast<std::size_t>(player) * static_cast<std::size_t>(m_maxRound) + static_cast<std::size_t>(round);
 }
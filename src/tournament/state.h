@@ -3,22 +3,175 @@
 
 #pragma once
 
+#include <QSharedDataPointer>
+
+#include <memory>
+#include <optional>
+
 #include "tournament.h"
 
+/*!
+ * \class State
+ * \inmodule tournament
+ * \inheaderfile tournament/state.h
+ *
+ * \brief Snapshot of the games of a tournament up to a round, used to compute
+ * standings and tiebreaks.
+ *
+ * The games are stored in flat arrays, one row per player and one column per
+ * round. Players are identified by their index, which is their starting rank minus
+ * one, and rounds are zero based.
+ *
+ * Along with the games, the state keeps for every round the cumulative points,
+ * the points for tiebreaks and the number of games played with each color. The
+ * data is implicitly shared, so cutOff() returns the state after an earlier round
+ * without reading the games again.
+ *
+ * Values depending on the games of the opponents, like buchholz(), are computed
+ * the first time they are requested and cached. The cache can be filled from
+ * several threads at the same time.
+ */
 class State
 {
 public:
     explicit State(Tournament *tournament, std::optional<int> maxRound = std::nullopt);
+    State(const State &other);
+    State(State &&other) noexcept;
+    ~State();
+
+    State &operator=(const State &other);
+    State &operator=(State &&other) noexcept;
 
     [[nodiscard]] int lastRound() const;
 
-    QList<Pairing *> pairings(Player *player) const;
-    double points(Player *player) const;
-    double pointsForTiebreaks(Player *player) const;
+    /*!
+     * Returns the state after \a maxRound, which can't be greater than lastRound().
+     */
+    [[nodiscard]] State cutOff(int maxRound) const;
+
+    [[nodiscard]] int numberOfPlayers() const;
+
+    /*!
+     * Returns the index of \a player.
+     */
+    [[nodiscard]] static int index(const Player *player);
+
+    /*!
+     * Returns the player at \a index.
+     */
+    [[nodiscard]] Player *player(int index) const;
+
+    /*!
+     * Returns the rating of the player at \a index, or 0 if the player is unrated.
+     */
+    [[nodiscard]] int rating(int player) const;
+
+    /*!
+     * Returns the pairing of \a player in \a round, or nullptr if the player was
+     * not paired.
+     */
+    [[nodiscard]] Pairing *pairing(int player, int round) const;
+
+    [[nodiscard]] bool hasPairing(int player, int round) const;
+
+    /*!
+     * Returns the round of \a pairing, or std::nullopt if the pairing is not part
+     * of the state.
+     */
+    [[nodiscard]] std::optional<int> round(Pairing *pairing) const;
+
+    /*!
+     * Returns the index of the opponent of \a player in \a round, or -1 if the
+     * player did not have an opponent.
+     */
+    [[nodiscard]] int opponent(int player, int round) const;
+
+    [[nodiscard]] Pairing::Color color(int player, int round) const;
+    [[nodiscard]] Pairing::PartialResult result(int player, int round) const;
+    [[nodiscard]] double points(int player, int round) const;
+
+    [[nodiscard]] double points(int player) const;
+    [[nodiscard]] double pointsForTiebreaks(int player) const;
+
+    /*!
+     * Returns the number of played games of \a player with the white pieces.
+     */
+    [[nodiscard]] int gamesWithWhite(int player) const;
+
+    /*!
+     * Returns the number of played games of \a player with the black pieces.
+     */
+    [[nodiscard]] int gamesWithBlack(int player) const;
+
+    /*!
+     * Returns the points for tiebreaks of the opponent of \a player in \a round, or
+     * 0 if the player did not have an opponent.
+     *
+     * The scores of the opponents of all the players are computed at once, the first
+     * time one of them is requested.
+     */
+    [[nodiscard]] double opponentScore(int player, int round) const;
+
+    /*!
+     * Returns the points of \a player counting a game played in the last round as
+     * a draw.
+     */
+    [[nodiscard]] double forePoints(int player) const;
+
+    /*!
+     * Returns the points for tiebreaks of \a player counting a game played in the
+     * last round as a draw.
+     */
+    [[nodiscard]] double forePointsForTiebreaks(int player) const;
+
+    /*!
+     * Same as opponentScore(), but counting the games played in the last round as
+     * draws.
+     */
+    [[nodiscard]] double foreOpponentScore(int player, int round) const;
+
+    /*!
+     * Returns the sum of the points for tiebreaks of the opponents of \a player,
+     * without any cut. Unplayed rounds count as a game against a dummy opponent
+     * with the same points as the player.
+     */
+    [[nodiscard]] double buchholz(int player) const;
+
+    /*!
+     * Computes \a aggregates for all the players, so they are already cached when
+     * they are requested.
+     */
+    void precompute(Tiebreak::Aggregates aggregates) const;
+
+    /*!
+     * Computes \a aggregates like precompute(), reusing the values of \a previous,
+     * the cut-off of the same state one round earlier.
+     *
+     * The Buchholz of every player is carried forward from \a previous: only the
+     * points gained in the last round by the opponents of the earlier rounds, and
+     * the opponent of the last round, are added to it.
+     */
+    void precompute(Tiebreak::Aggregates aggregates, const State &previous) const;
+
+    /*!
+     * Reads again the results of \a pairing.
+     *
+     * Returns false if the pairing is not part of the state.
+     */
+    bool update(Pairing *pairing);
 
 private:
-    Tournament *m_tournament;
+    class Data;
+    class Cache;
+
+    [[nodiscard]] std::size_t cell(int player, int round) const;
+
+    // Index in the arrays of the cache, which only have the rounds of the view
+    [[nodiscard]] std::size_t viewCell(int player, int round) const;
+
+    QSharedDataPointer<Data> d;
     int m_maxRound;
 
-    QHash<Player *, QList<Pairing *>> m_pairingsByPlayer;
+    // Depends on m_maxRound, so it is only shared by copies of the same view
+    std::shared_ptr<Cache> m_cache;
 };
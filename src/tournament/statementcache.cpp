@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "statementcache.h"
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include <algorithm>
+#include <utility>
+
+StatementCache::Statement::Statement(Entry *entry, std::unique_ptr<QSqlQuery> query)
+    : m_entry(entry)
+    , m_query(std::move(query))
+{
+}
+
+StatementCache::Statement::Statement(Statement &&other) noexcept
+    : m_entry(std::exchange(other.m_entry, nullptr))
+    , m_query(std::move(other.m_query))
+{
+}
+
+StatementCache::Statement::~Statement()
+{
+    if (m_entry == nullptr || m_query) {
+        return;
+    }
+
+    // Release the cached query, keeping it prepared
+    m_entry->query.finish();
+    m_entry->busy = false;
+}
+
+void StatementCache::Statement::bindValue(const QString &placeholder, const QVariant &value)
+{
+    query().bindValue(placeholder, value);
+}
+
+bool StatementCache::Statement::exec()
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    const bool ok = query().exec();
+
+    m_entry->statistics.executions++;
+    m_entry->statistics.elapsed += std::chrono::nanoseconds(timer.nsecsElapsed());
+
+    return ok;
+}
+
+QSqlError StatementCache::Statement::lastError() const
+{
+    return m_query ? m_query->lastError() : m_entry->query.lastError();
+}
+
+QSqlQuery &StatementCache::Statement::query()
+{
+    Q_ASSERT(m_entry != nullptr);
+
+    return m_query ? *m_query : m_entry->query;
+}
+
+StatementCache::StatementCache(const QSqlDatabase &db)
+    : m_db(db)
+{
+}
+
+StatementCache::~StatementCache() = default;
+
+QSqlDatabase StatementCache::database() const
+{
+    return m_db;
+}
+
+std::expected<StatementCache::Statement, QString> StatementCache::statement(const QString &sql)
+{
+    auto it = m_entries.find(sql);
+
+    if (it == m_entries.end()) {
+        auto entry = std::make_unique<Entry>(m_db);
+        entry->statistics.sql = sql;
+
+        if (!entry->query.prepare(sql)) {
+            return std::unexpected(entry->query.lastError().text());
+        }
+
+        it = m_entries.emplace(sql, std::move(entry)).first;
+    }
+
+    auto *entry = it->second.get();
+
+    if (entry->busy) {
+        auto query = std::make_unique<QSqlQuery>(m_db);
+
+        if (!query->prepare(sql)) {
+            return std::unexpected(query->lastError().text());
+        }
+
+        return Statement(entry, std::move(query));
+    }
+
+    entry->busy = true;
+
+    return Statement(entry, nullptr);
+}
+
+QList<StatementCache::Statistics> StatementCache::statistics() const
+{
+    QList<Statistics> statistics;
+    statistics.reserve(static_cast<qsizetype>(m_entries.size()));
+
+    for (const auto &[sql, entry] : m_entries) {
+        statistics << entry->statistics;
+    }
+
+    std::ranges::sort(statistics, [](const Statistics &a, const Statistics &b) {
+        return a.elapsed > b.elapsed;
+    });
+
+    return statistics;
+}
+
+QDebug operator<<(QDebug dbg, const StatementCache::Statistics &statistics)
+{
+    QDebugStateSaver saver(dbg);
+    dbg.nospace() << statistics.executions << " executions in "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(statistics.elapsed).count() << " us: " << statistics.sql;
+
+    return dbg;
+}
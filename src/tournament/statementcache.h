@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QDebug>
+#include <QList>
+#include <QSqlDatabase>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QString>
+#include <QVariant>
+
+#include <chrono>
+#include <expected>
+#include <memory>
+#include <unordered_map>
+
+/*!
+ * \class StatementCache
+ * \inmodule tournament
+ * \inheaderfile tournament/statementcache.h
+ *
+ * \brief Prepares the statements of a database connection once and reuses them.
+ *
+ * Statements are identified by their SQL text, usually one of the constants of
+ * db.h. The first time a statement is requested it is prepared, and later requests
+ * get a handle to the same prepared query, so SQLite doesn't parse and plan it
+ * again.
+ *
+ * The cache also counts how many times every statement is executed and how long it
+ * takes, so the hot statements can be found.
+ *
+ * The handles must not outlive the cache, and the cache must be destroyed before
+ * the connection is closed.
+ */
+class StatementCache
+{
+    struct Entry;
+
+public:
+    /*!
+     * Executions of a statement.
+     */
+    struct Statistics {
+        QString sql;
+        qint64 executions = 0;
+        std::chrono::nanoseconds elapsed{0};
+    };
+
+    /*!
+     * \class StatementCache::Statement
+     * \inmodule tournament
+     *
+     * \brief Handle to a prepared statement of the cache.
+     *
+     * The statement is reserved while the handle exists. If it is requested again
+     * in the meantime, for example while the results of a query are still being
+     * read, the new handle gets its own prepared query.
+     */
+    class Statement
+    {
+    public:
+        Statement(Statement &&other) noexcept;
+        Statement(const Statement &) = delete;
+        ~Statement();
+
+        Statement &operator=(const Statement &) = delete;
+        Statement &operator=(Statement &&) = delete;
+
+        void bindValue(const QString &placeholder, const QVariant &value);
+
+        /*!
+         * Executes the statement with the values bound so far.
+         *
+         * Returns true if successful; false otherwise.
+         */
+        bool exec();
+
+        [[nodiscard]] QSqlError lastError() const;
+
+        /*!
+         * Returns the underlying query, to read the results.
+         */
+        [[nodiscard]] QSqlQuery &query();
+
+    private:
+        friend class StatementCache;
+
+        Statement(Entry *entry, std::unique_ptr<QSqlQuery> query);
+
+        Entry *m_entry;
+
+        // Only set when the cached query was already in use
+        std::unique_ptr<QSqlQuery> m_query;
+    };
+
+    explicit StatementCache(const QSqlDatabase &db);
+    ~StatementCache();
+
+    StatementCache(const StatementCache &) = delete;
+    StatementCache &operator=(const StatementCache &) = delete;
+
+    /*!
+     * Returns the connection of the statements.
+     */
+    [[nodiscard]] QSqlDatabase database() const;
+
+    /*!
+     * Returns a handle to the statement \a sql, which is prepared the first time it
+     * is requested.
+     */
+    std::expected<Statement, QString> statement(const QString &sql);
+
+    /*!
+     * Returns the statistics of the statements, starting with the one that took
+     * longest overall.
+     */
+    [[nodiscard]] QList<Statistics> statistics() const;
+
+private:
+    struct Entry {
+        explicit Entry(const QSqlDatabase &db)
+            : query(db)
+        {
+        }
+
+        QSqlQuery query;
+        Statistics statistics;
+        bool busy = false;
+    };
+
+    QSqlDatabase m_db;
+    std::unordered_map<QString, std::unique_ptr<Entry>> m_entries;
+};
+
+QDebug operator<<(QDebug dbg, const StatementCache::Statistics &statistics);
@@ -28,5 +28,15 @@ public:
         return "AOB"_L1;
     }
 
-    double calculate(Tournament *tournament, State state, QList<Player *> players, Player *player) override;
+    double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) override;
+
+    [[nodiscard]] std::optional<int> dependencyDepth() override
+    {
+        return 2;
+    }
+
+    [[nodiscard]] Aggregates aggregates() override
+    {
+        return Aggregate::Buchholz;
+    }
 };
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#include "apro.h"
+#include "pairing.h"
+#include "performance.h"
+#include "state.h"
+
+#include <cmath>
+
+double AveragePerformanceRatingOfOpponents::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
+{
+    Q_UNUSED(tournament)
+    Q_UNUSED(players)
+
+    double result = 0.;
+    int count = 0;
+
+    const auto index = State::index(player);
+    for (int round = 0; round < state.lastRound(); ++round) {
+        if (state.hasPairing(index, round) && !Pairing::isUnplayed(state.result(index, round))) {
+            result += Performance::tournamentPerformanceRating(state, state.opponent(index, round));
+            ++count;
+        }
+    }
+
+    if (count > 0) {
+        return std::floor(result / count + .5);
+    }
+
+    return 0.;
+}
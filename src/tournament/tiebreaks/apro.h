@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#pragma once
+
+#include "tiebreak.h"
+
+#include <KLocalizedString>
+
+using namespace Qt::Literals::StringLiterals;
+
+class AveragePerformanceRatingOfOpponents : public Tiebreak
+{
+public:
+    [[nodiscard]] QString id() override
+    {
+        return "apro"_L1;
+    }
+
+    [[nodiscard]] QString name() override
+    {
+        return i18nc("Tiebreak", "Average Performance Rating of Opponents");
+    };
+
+    [[nodiscard]] QString code() override
+    {
+        return "APRO"_L1;
+    }
+
+    double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) override;
+
+    [[nodiscard]] std::optional<int> dependencyDepth() override
+    {
+        return 1;
+    }
+};
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#include "aro.h"
+#include "performance.h"
+#include "state.h"
+
+QList<QVariantMap> AverageRatingOfOpponents::options()
+{
+    return {
+        {
+            {"id"_L1, "cut_lowest"_L1},
+            {"name"_L1, i18nc("@label:spinbox", "Exclude the lowest ratings:")},
+            {"type"_L1, "number"_L1},
+            {"value"_L1, option("cut_lowest"_L1, 0)},
+        },
+    };
+}
+
+std::expected<void, QString> AverageRatingOfOpponents::setTrfOptions(const QList<QString> &options)
+{
+    for (const auto &option : options) {
+        if (option.startsWith(u'C', Qt::CaseSensitivity::CaseInsensitive)) {
+            bool ok;
+            const int cutLowest = option.mid(1).toInt(&ok);
+            if (!ok || cutLowest <= 0) {
+                return std::unexpected(i18nc("@info", "Unsupported tiebreak option \"%1\"", option));
+            }
+            setOption("cut_lowest"_L1, cutLowest);
+        }
+    }
+
+    return {};
+}
+
+double AverageRatingOfOpponents::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
+{
+    Q_UNUSED(tournament)
+    Q_UNUSED(players)
+
+    return Performance::averageRatingOfOpponents(state, State::index(player), option("cut_lowest"_L1, 0).toInt());
+}
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#pragma once
+
+#include "tiebreak.h"
+
+#include <KLocalizedString>
+#include <QLocale>
+
+using namespace Qt::Literals::StringLiterals;
+
+class AverageRatingOfOpponents : public Tiebreak
+{
+public:
+    [[nodiscard]] QString id() override
+    {
+        return "aro"_L1;
+    }
+
+    [[nodiscard]] QString name() override
+    {
+        const auto cutLowest = option("cut_lowest"_L1, 0).toInt();
+        if (cutLowest == 0) {
+            return i18nc("Tiebreak", "Average Rating of Opponents");
+        }
+        const auto cutText = QLocale::system().toString(-cutLowest);
+        return i18nc("Average Rating of Opponents N tiebreak, N is a number < 0", "Average Rating of Opponents %1", cutText);
+    };
+
+    [[nodiscard]] QString code() override
+    {
+        const auto cutLowest = option("cut_lowest"_L1, 0).toInt();
+        if (cutLowest == 0) {
+            return "ARO"_L1;
+        }
+        return "ARO/C%1"_L1.arg(QString::number(cutLowest));
+    }
+
+    [[nodiscard]] bool isConfigurable() override
+    {
+        return true;
+    }
+
+    [[nodiscard]] QList<QVariantMap> options() override;
+
+    std::expected<void, QString> setTrfOptions(const QList<QString> &options) override;
+
+    double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) override;
+
+    [[nodiscard]] std::optional<int> dependencyDepth() override
+    {
+        return 0;
+    }
+};
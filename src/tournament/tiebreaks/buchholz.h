@@ -3,14 +3,13 @@
 
 #pragma once
 
-#include "tiebreak.h"
+#include "opponentscores.h"
 
 #include <KLocalizedString>
-#include <QLocale>
 
 using namespace Qt::Literals::StringLiterals;
 
-class Buchholz : public Tiebreak
+class Buchholz : public OpponentScoresTiebreak
 {
 public:
     [[nodiscard]] QString id() override
@@ -18,33 +17,31 @@ public:
         return "bh"_L1;
     }
 
-    [[nodiscard]] QString name() override
-    {
-        const auto cutLowest = option("cut_lowest"_L1, 0).toInt();
-        if (cutLowest == 0) {
-            return i18nc("Buchholz tiebreak", "Buchholz");
-        }
-        const auto cutText = QLocale::system().toString(-cutLowest);
-        return i18nc("Buchholz N tiebreak, N is a number < 0", "Buchholz %1", cutText);
-    };
+    double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) override;
 
-    [[nodiscard]] QString code() override
+    [[nodiscard]] Aggregates aggregates() override
     {
-        const auto cutLowest = option("cut_lowest"_L1, 0).toInt();
-        if (cutLowest == 0) {
-            return "BH"_L1;
+        // Without modifiers it is the Buchholz cached by the state
+        if (hasModifiers()) {
+            return Aggregate::OpponentScores;
         }
-        return "BH/C%1"_L1.arg(QString::number(cutLowest));
+        return Aggregate::Buchholz;
     }
 
-    [[nodiscard]] bool isConfigurable() override
+protected:
+    [[nodiscard]] QString baseName() override
     {
-        return true;
+        return i18nc("Buchholz tiebreak", "Buchholz");
     }
 
-    [[nodiscard]] QList<QVariantMap> options() override;
-
-    std::expected<void, QString> setTrfOptions(const QList<QString> &options) override;
+    [[nodiscard]] QString baseCode() override
+    {
+        return "BH"_L1;
+    }
 
-    double calculate(Tournament *tournament, State state, QList<Player *> players, Player *player) override;
+    [[nodiscard]] double contribution(double opponentScore, double points) override
+    {
+        Q_UNUSED(points)
+        return opponentScore;
+    }
 };
@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#include "directencounter.h"
+#include "state.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <numeric>
+
+namespace
+{
+// Games among a group of tied players. The players are identified by their
+// position in the group.
+class Encounters
+{
+public:
+    explicit Encounters(const State &state, const QList<Player *> &players);
+
+    [[nodiscard]] std::vector<double> values();
+
+private:
+    using Mask = std::vector<std::uint64_t>;
+
+    struct Game {
+        int opponent;
+        double points;
+    };
+
+    // Ranks members from position, iterating while the group shrinks
+    void rank(const std::vector<int> &members, int position);
+
+    [[nodiscard]] Mask mask(const std::vector<int> &members) const;
+
+    [[nodiscard]] static bool contains(const Mask &mask, int player)
+    {
+        return (mask[static_cast<std::size_t>(player / 64)] >> (player % 64)) & 1U;
+    }
+
+    int m_size;
+    std::size_t m_words;
+
+    // One row per player with a bit set for each opponent met
+    std::vector<std::uint64_t> m_met;
+
+    // Games of each player against players of the group
+    std::vector<Game> m_games;
+    std::vector<std::size_t> m_offsets;
+
+    std::vector<double> m_values;
+};
+
+Encounters::Encounters(const State &state, const QList<Player *> &players)
+    : m_size(static_cast<int>(players.size()))
+    , m_words(static_cast<std::size_t>((m_size + 63) / 64))
+    , m_met(static_cast<std::size_t>(m_size) * m_words, 0)
+    , m_values(static_cast<std::size_t>(m_size), 0.)
+{
+    std::vector<int> positions(static_cast<std::size_t>(state.numberOfPlayers()), -1);
+    for (int i = 0; i < m_size; ++i) {
+        positions[State::index(players.at(i))] = i;
+    }
+
+    m_offsets.reserve(static_cast<std::size_t>(m_size) + 1);
+    m_offsets.push_back(0);
+
+    for (int i = 0; i < m_size; ++i) {
+        const auto index = State::index(players.at(i));
+        for (int round = 0; round < state.lastRound(); ++round) {
+            const auto opponent = state.opponent(index, round);
+            if (opponent < 0 || positions[opponent] < 0) {
+                continue;
+            }
+
+            const auto j = positions[opponent];
+            m_met[static_cast<std::size_t>(i) * m_words + static_cast<std::size_t>(j / 64)] |= std::uint64_t{1} << (j % 64);
+            m_games.push_back({j, state.points(index, round)});
+        }
+        m_offsets.push_back(m_games.size());
+    }
+}
+
+std::vector<double> Encounters::values()
+{
+    std::vector<int> members(static_cast<std::size_t>(m_size));
+    std::iota(members.begin(), members.end(), 0);
+
+    rank(members, 0);
+
+    return m_values;
+}
+
+Encounters::Mask Encounters::mask(const std::vector<int> &members) const
+{
+    Mask mask(m_words, 0);
+    for (const auto member : members) {
+        mask[static_cast<std::size_t>(member / 64)] |= std::uint64_t{1} << (member % 64);
+    }
+    return mask;
+}
+
+void Encounters::rank(const std::vector<int> &members, int position)
+{
+    const auto tie = [this, &members, position]() {
+        for (const auto member : members) {
+            m_values[member] = m_size - position;
+        }
+    };
+
+    if (members.size() == 1) {
+        tie();
+        return;
+    }
+
+    const auto group = mask(members);
+    const auto size = static_cast<int>(members.size());
+
+    std::vector<double> points(members.size(), 0.);
+    std::vector<int> met(members.size(), 0);
+
+    for (std::size_t k = 0; k < members.size(); ++k) {
+        const auto member = members[k];
+        for (auto g = m_offsets[member]; g < m_offsets[member + 1]; ++g) {
+            if (contains(group, m_games[g].opponent)) {
+                points[k] += m_games[g].points;
+            }
+        }
+
+        const auto row = m_met.cbegin() + static_cast<std::ptrdiff_t>(static_cast<std::size_t>(member) * m_words);
+        for (std::size_t w = 0; w < m_words; ++w) {
+            met[k] += std::popcount(row[static_cast<std::ptrdiff_t>(w)] & group[w]);
+        }
+    }
+
+    const bool allMet = std::ranges::all_of(met, [size](int count) {
+        return count == size - 1;
+    });
+
+    if (allMet) {
+        std::vector<std::size_t> order(members.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::stable_sort(order, [&points](std::size_t a, std::size_t b) {
+            return points[a] > points[b];
+        });
+
+        if (points[order.front()] == points[order.back()]) {
+            tie();
+            return;
+        }
+
+        // Players with the same points among them are ranked again among themselves
+        for (std::size_t begin = 0; begin < order.size();) {
+            auto end = begin + 1;
+            while (end < order.size() && points[order[end]] == points[order[begin]]) {
+                ++end;
+            }
+
+            std::vector<int> tied;
+            tied.reserve(end - begin);
+            for (auto k = begin; k < end; ++k) {
+                tied.push_back(members[order[k]]);
+            }
+            rank(tied, position + static_cast<int>(begin));
+
+            begin = end;
+        }
+        return;
+    }
+
+    // Not all the players have met: a player is first only if nobody else could
+    // reach their points by winning the games they didn't play
+    for (std::size_t k = 0; k < members.size(); ++k) {
+        bool first = true;
+        for (std::size_t j = 0; j < members.size() && first; ++j) {
+            if (j != k && points[j] + (size - 1 - met[j]) >= points[k]) {
+                first = false;
+            }
+        }
+
+        if (first) {
+            m_values[members[k]] = m_size - position;
+
+            auto rest = members;
+            rest.erase(rest.begin() + static_cast<std::ptrdiff_t>(k));
+            rank(rest, position + 1);
+            return;
+        }
+    }
+
+    tie();
+}
+}
+
+double DirectEncounter::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
+{
+    const auto values = calculateGroup(tournament, state, players);
+    return values[static_cast<std::size_t>(players.indexOf(player))];
+}
+
+std::vector<double> DirectEncounter::calculateGroup(Tournament *tournament, const State &state, const QList<Player *> &players)
+{
+    Q_UNUSED(tournament)
+
+    return Encounters{state, players}.values();
+}
@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#pragma once
+
+#include "tiebreak.h"
+
+#include <KLocalizedString>
+
+using namespace Qt::Literals::StringLiterals;
+
+// Ranks the tied players by the games played among them. The value of a player is
+// only meaningful compared to the players of the same group: higher is better.
+class DirectEncounter : public Tiebreak
+{
+public:
+    [[nodiscard]] QString id() override
+    {
+        return "de"_L1;
+    }
+
+    [[nodiscard]] QString name() override
+    {
+        return i18nc("Tiebreak", "Direct Encounter");
+    };
+
+    [[nodiscard]] QString code() override
+    {
+        return "DE"_L1;
+    }
+
+    double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) override;
+
+    [[nodiscard]] std::vector<double> calculateGroup(Tournament *tournament, const State &state, const QList<Player *> &players) override;
+};
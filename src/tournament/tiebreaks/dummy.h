@@ -28,7 +28,7 @@ public:
         return {};
     }
 
-    double calculate(Tournament *tournament, State state, QList<Player *> players, Player *player) override
+    double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) override
     {
         Q_UNUSED(tournament)
         Q_UNUSED(state)
@@ -37,4 +37,17 @@ public:
 
         return 0;
     }
+
+    [[nodiscard]] std::vector<double> calculateGroup(Tournament *tournament, const State &state, const QList<Player *> &players) override
+    {
+        Q_UNUSED(tournament)
+        Q_UNUSED(state)
+
+        return std::vector<double>(players.size(), 0.);
+    }
+
+    [[nodiscard]] std::optional<int> dependencyDepth() override
+    {
+        return 0;
+    }
 };
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#pragma once
+
+#include "opponentscores.h"
+
+#include <KLocalizedString>
+
+using namespace Qt::Literals::StringLiterals;
+
+// Buchholz counting all the games of the last round as draws
+class ForeBuchholz : public OpponentScoresTiebreak
+{
+public:
+    [[nodiscard]] QString id() override
+    {
+        return "fb"_L1;
+    }
+
+protected:
+    [[nodiscard]] QString baseName() override
+    {
+        return i18nc("Fore Buchholz tiebreak", "Fore Buchholz");
+    }
+
+    [[nodiscard]] QString baseCode() override
+    {
+        return "FB"_L1;
+    }
+
+    [[nodiscard]] bool isFore() override
+    {
+        return true;
+    }
+
+    [[nodiscard]] double contribution(double opponentScore, double points) override
+    {
+        Q_UNUSED(points)
+        return opponentScore;
+    }
+};
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#include "koya.h"
+#include "pairing.h"
+#include "state.h"
+
+double KoyaSystem::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
+{
+    Q_UNUSED(tournament)
+    Q_UNUSED(players)
+
+    const auto index = State::index(player);
+    const auto threshold = state.lastRound() / 2.;
+
+    double result = 0.;
+    for (int round = 0; round < state.lastRound(); ++round) {
+        if (!state.hasPairing(index, round) || Pairing::isUnplayed(state.result(index, round))) {
+            continue;
+        }
+        if (state.pointsForTiebreaks(state.opponent(index, round)) >= threshold) {
+            result += state.points(index, round);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#pragma once
+
+#include "tiebreak.h"
+
+#include <KLocalizedString>
+
+using namespace Qt::Literals::StringLiterals;
+
+// Points scored against the opponents with at least half of the maximum score
+class KoyaSystem : public Tiebreak
+{
+public:
+    [[nodiscard]] QString id() override
+    {
+        return "ks"_L1;
+    }
+
+    [[nodiscard]] QString name() override
+    {
+        return i18nc("Tiebreak", "Koya System");
+    };
+
+    [[nodiscard]] QString code() override
+    {
+        return "KS"_L1;
+    }
+
+    double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) override;
+
+    [[nodiscard]] std::optional<int> dependencyDepth() override
+    {
+        return 1;
+    }
+};
@@ -4,16 +4,19 @@
 #include "numberwins.h"
 #include "state.h"
 
-double NumberOfWins::calculate(Tournament *tournament, State state, QList<Player *> players, Player *player)
+double NumberOfWins::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
 {
     Q_UNUSED(tournament)
     Q_UNUSED(players)
 
-    const auto pairings = state.pairings(player);
+    const auto index = State::index(player);
 
-    const auto result = std::ranges::count_if(pairings, [&player](Pairing *pairing) {
-        return pairing->pointsOfPlayer(player) == 1.;
-    });
+    int result = 0;
+    for (int round = 0; round < state.lastRound(); ++round) {
+        if (state.hasPairing(index, round) && state.points(index, round) == 1.) {
+            ++result;
+        }
+    }
 
     return static_cast<double>(result);
 }
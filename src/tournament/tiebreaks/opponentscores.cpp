@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#include "opponentscores.h"
+#include "pairing.h"
+#include "state.h"
+
+#include <QLocale>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+QString OpponentScoresTiebreak::name()
+{
+    const auto cutLowest = option("cut_lowest"_L1, 0).toInt();
+    const auto cutHighest = option("cut_highest"_L1, 0).toInt();
+
+    if (cutHighest > 0 && cutHighest == cutLowest) {
+        const auto cutText = QLocale::system().toString(cutLowest);
+        return i18nc("Tiebreak excluding the N highest and lowest scores. %1 is the name of the tiebreak, %2 is N", "%1 Median %2", baseName(), cutText);
+    }
+    if (cutLowest > 0) {
+        const auto cutText = QLocale::system().toString(-cutLowest);
+        return i18nc("Tiebreak excluding the N lowest scores. %1 is the name of the tiebreak, %2 is -N", "%1 %2", baseName(), cutText);
+    }
+    return baseName();
+}
+
+QString OpponentScoresTiebreak::code()
+{
+    const auto cutLowest = option("cut_lowest"_L1, 0).toInt();
+    const auto cutHighest = option("cut_highest"_L1, 0).toInt();
+
+    if (cutHighest > 0 && cutHighest == cutLowest) {
+        return "%1/M%2"_L1.arg(baseCode(), QString::number(cutLowest));
+    }
+    if (cutLowest > 0) {
+        return "%1/C%2"_L1.arg(baseCode(), QString::number(cutLowest));
+    }
+    return baseCode();
+}
+
+QList<QVariantMap> OpponentScoresTiebreak::options()
+{
+    return {
+        {
+            {"id"_L1, "cut_lowest"_L1},
+            {"name"_L1, i18nc("@label:spinbox", "Exclude the lowest scores:")},
+            {"type"_L1, "number"_L1},
+            {"value"_L1, option("cut_lowest"_L1, 0)},
+        },
+        {
+            {"id"_L1, "cut_highest"_L1},
+            {"name"_L1, i18nc("@label:spinbox", "Exclude the highest scores:")},
+            {"type"_L1, "number"_L1},
+            {"value"_L1, option("cut_highest"_L1, 0)},
+        },
+        {
+            {"id"_L1, "forfeit_regular"_L1},
+            {"name"_L1, i18nc("@option:check", "Forfeited games as played games")},
+            {"type"_L1, "checkbox"_L1},
+            {"value"_L1, option("forfeit_regular"_L1, false)},
+        },
+    };
+}
+
+std::expected<void, QString> OpponentScoresTiebreak::setTrfOptions(const QList<QString> &options)
+{
+    for (const auto &option : options) {
+        const bool cut = option.startsWith(u'C', Qt::CaseSensitivity::CaseInsensitive);
+        const bool median = option.startsWith(u'M', Qt::CaseSensitivity::CaseInsensitive);
+        if (!cut && !median) {
+            continue;
+        }
+
+        bool ok;
+        const int value = option.mid(1).toInt(&ok);
+        if (!ok || value <= 0) {
+            return std::unexpected(i18nc("@info", "Unsupported tiebreak option \"%1\"", option));
+        }
+
+        setOption("cut_lowest"_L1, value);
+        if (median) {
+            setOption("cut_highest"_L1, value);
+        }
+    }
+
+    return {};
+}
+
+double OpponentScoresTiebreak::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
+{
+    Q_UNUSED(tournament)
+    Q_UNUSED(players)
+
+    const auto index = State::index(player);
+    const bool fore = isFore();
+    const bool forfeitsAsPlayed = option("forfeit_regular"_L1, false).toBool();
+
+    // 16.4: unplayed rounds are evaluated as games against a dummy opponent with
+    // the same points as the player
+    const auto ownScore = fore ? state.forePoints(index) : state.points(index);
+
+    std::vector<double> contributions;
+    std::vector<double> vurContributions;
+
+    for (int round = 0; round < state.lastRound(); ++round) {
+        if (!state.hasPairing(index, round)) {
+            continue;
+        }
+
+        const auto result = state.result(index, round);
+        const bool played = !Pairing::isUnplayed(result) || (forfeitsAsPlayed && state.opponent(index, round) >= 0);
+
+        double score;
+        if (!played) {
+            score = ownScore;
+        } else if (fore) {
+            score = state.foreOpponentScore(index, round);
+        } else {
+            score = state.opponentScore(index, round);
+        }
+
+        const auto value = contribution(score, state.points(index, round));
+
+        if (!played && Pairing::isVUR(result)) {
+            vurContributions.push_back(value);
+        } else {
+            contributions.push_back(value);
+        }
+    }
+
+    const uint cutLowest = option("cut_lowest"_L1, 0).toUInt();
+    const uint cutHighest = option("cut_highest"_L1, 0).toUInt();
+
+    // Sort contributions in descending order so we can pop_back the lowest value.
+    std::ranges::sort(contributions, std::ranges::greater());
+    std::ranges::sort(vurContributions, std::ranges::greater());
+
+    // 14.4: the contributions of voluntary unplayed rounds are cut first
+    for (uint i = 0; i < cutLowest; ++i) {
+        if (!vurContributions.empty()) {
+            vurContributions.pop_back();
+        } else if (!contributions.empty()) {
+            contributions.pop_back();
+        }
+    }
+
+    for (uint i = 0; i < cutHighest; ++i) {
+        if (!contributions.empty() && (vurContributions.empty() || contributions.front() >= vurContributions.front())) {
+            contributions.erase(contributions.begin());
+        } else if (!vurContributions.empty()) {
+            vurContributions.erase(vurContributions.begin());
+        }
+    }
+
+    return std::accumulate(contributions.cbegin(), contributions.cend(), 0.) + std::accumulate(vurContributions.cbegin(), vurContributions.cend(), 0.);
+}
+
+Tiebreak::Aggregates OpponentScoresTiebreak::aggregates()
+{
+    return isFore() ? Aggregate::ForeOpponentScores : Aggregate::OpponentScores;
+}
+
+bool OpponentScoresTiebreak::hasModifiers()
+{
+    return option("cut_lowest"_L1, 0).toInt() > 0 || option("cut_highest"_L1, 0).toInt() > 0 || option("forfeit_regular"_L1, false).toBool();
+}
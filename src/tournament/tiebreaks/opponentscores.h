@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#pragma once
+
+#include "tiebreak.h"
+
+#include <KLocalizedString>
+
+using namespace Qt::Literals::StringLiterals;
+
+// Base of the tiebreaks adding a contribution for each round computed from the
+// score of the opponent: Buchholz, Sonneborn-Berger and Fore Buchholz. They share
+// the modifiers to exclude the lowest and highest contributions and to count
+// forfeited games as played games.
+class OpponentScoresTiebreak : public Tiebreak
+{
+public:
+    [[nodiscard]] QString name() override;
+
+    [[nodiscard]] QString code() override;
+
+    [[nodiscard]] bool isConfigurable() override
+    {
+        return true;
+    }
+
+    [[nodiscard]] QList<QVariantMap> options() override;
+
+    std::expected<void, QString> setTrfOptions(const QList<QString> &options) override;
+
+    double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) override;
+
+    [[nodiscard]] std::optional<int> dependencyDepth() override
+    {
+        return 1;
+    }
+
+    [[nodiscard]] Aggregates aggregates() override;
+
+protected:
+    // Name and code of the tiebreak without modifiers
+    [[nodiscard]] virtual QString baseName() = 0;
+    [[nodiscard]] virtual QString baseCode() = 0;
+
+    // Whether the games of the last round are counted as draws
+    [[nodiscard]] virtual bool isFore()
+    {
+        return false;
+    }
+
+    // Contribution of a round where the player scored points against an opponent
+    // with opponentScore points
+    [[nodiscard]] virtual double contribution(double opponentScore, double points) = 0;
+
+    [[nodiscard]] bool hasModifiers();
+};
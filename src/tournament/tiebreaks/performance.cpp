@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#include "performance.h"
+#include "pairing.h"
+#include "state.h"
+
+#include <QVarLengthArray>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace
+{
+struct Games {
+    // Ratings of the opponents, one per game
+    QVarLengthArray<int, 16> ratings;
+    double points = 0.;
+};
+
+Games playedGames(const State &state, int player)
+{
+    Games games;
+
+    for (int round = 0; round < state.lastRound(); ++round) {
+        if (!state.hasPairing(player, round) || Pairing::isUnplayed(state.result(player, round))) {
+            continue;
+        }
+        games.ratings << Performance::rating(state, state.opponent(player, round));
+        games.points += state.points(player, round);
+    }
+
+    return games;
+}
+
+int roundedAverage(const int *begin, const int *end)
+{
+    if (begin == end) {
+        return 0;
+    }
+    const auto sum = std::accumulate(begin, end, 0LL);
+    return static_cast<int>(std::floor(static_cast<double>(sum) / static_cast<double>(end - begin) + .5));
+}
+}
+
+int Performance::rating(const State &state, int player)
+{
+    const auto rating = state.rating(player);
+    return rating > 0 ? rating : UnratedRating;
+}
+
+int Performance::averageRatingOfOpponents(const State &state, int player, int cutLowest)
+{
+    auto games = playedGames(state, player);
+
+    if (cutLowest > 0) {
+        std::ranges::sort(games.ratings);
+        cutLowest = std::min<int>(cutLowest, static_cast<int>(games.ratings.size()));
+    }
+
+    return roundedAverage(games.ratings.cbegin() + cutLowest, games.ratings.cend());
+}
+
+int Performance::tournamentPerformanceRating(const State &state, int player)
+{
+    const auto games = playedGames(state, player);
+    if (games.ratings.isEmpty()) {
+        return 0;
+    }
+
+    const auto percentage = static_cast<int>(std::lround(100. * games.points / static_cast<double>(games.ratings.size())));
+    return roundedAverage(games.ratings.cbegin(), games.ratings.cend()) + ratingDifference(percentage);
+}
+
+int Performance::perfectTournamentPerformance(const State &state, int player)
+{
+    const auto games = playedGames(state, player);
+    if (games.ratings.isEmpty()) {
+        return 0;
+    }
+
+    const auto [lowest, highest] = std::ranges::minmax(games.ratings);
+    if (games.points == 0.) {
+        return lowest - RatingDifferences.back();
+    }
+    if (games.points == static_cast<double>(games.ratings.size())) {
+        return highest + RatingDifferences.back();
+    }
+
+    const auto score = static_cast<int>(std::lround(100. * games.points));
+    const auto expected = [&games](int rating) {
+        int total = 0;
+        for (const auto opponent : games.ratings) {
+            total += expectedScore(rating - opponent);
+        }
+        return total;
+    };
+
+    // The expected score grows with the rating, so the lowest rating reaching the
+    // score of the player can be found with a binary search
+    int low = lowest - RatingDifferences.back();
+    int high = highest + RatingDifferences.back();
+    while (low < high) {
+        const auto middle = low + (high - low) / 2;
+        if (expected(middle) >= score) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+
+    return low;
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+
+class State;
+
+// Rating based tiebreaks, using the tables of the FIDE Rating Regulations
+namespace Performance
+{
+// Rating of unrated opponents, the rating floor of the FIDE Rating Regulations
+constexpr int UnratedRating = 1400;
+
+// Rating difference above which the expected score is 1
+constexpr int MaxDifference = 735;
+
+// Table 8.1.b: highest rating difference for each expected score from 0.50 to 0.99
+constexpr std::array<int, 50> ExpectedScoreBounds{3,   10,  17,  25,  32,  39,  46,  53,  61,  68,  76,  83,  91,  98,  106, 113, 121,
+                                                  129, 137, 145, 153, 162, 170, 179, 188, 197, 206, 215, 225, 235, 245, 256, 267, 278,
+                                                  290, 302, 315, 328, 344, 357, 374, 391, 411, 432, 456, 484, 517, 559, 619, MaxDifference};
+
+// Table 8.1.a: rating difference for each percentage score from 50% to 100%
+constexpr std::array<int, 51> RatingDifferences{0,   7,   14,  21,  29,  36,  43,  50,  57,  65,  72,  80,  87,  95,  102, 110, 117,
+                                                125, 133, 141, 149, 158, 166, 175, 184, 193, 202, 211, 220, 230, 240, 251, 262, 273,
+                                                284, 296, 309, 322, 336, 351, 366, 383, 401, 422, 444, 470, 501, 538, 589, 677, 800};
+
+// Expected score in hundredths of the higher rated player for each rating difference
+constexpr std::array<std::int8_t, MaxDifference + 1> ExpectedScores = [] {
+    std::array<std::int8_t, MaxDifference + 1> scores{};
+    int difference = 0;
+    for (int i = 0; i < std::ssize(ExpectedScoreBounds); ++i) {
+        for (; difference <= ExpectedScoreBounds[i]; ++difference) {
+            scores[difference] = static_cast<std::int8_t>(50 + i);
+        }
+    }
+    return scores;
+}();
+
+// Both tables describe the same conversion
+static_assert([] {
+    for (int i = 0; i < std::ssize(ExpectedScoreBounds); ++i) {
+        const auto lowest = i == 0 ? -ExpectedScoreBounds[0] : ExpectedScoreBounds[i - 1] + 1;
+        if (RatingDifferences[i] < lowest || RatingDifferences[i] > ExpectedScoreBounds[i]) {
+            return false;
+        }
+    }
+    return true;
+}());
+
+/*!
+ * Returns the expected score in hundredths of a player against an opponent rated
+ * \a difference points lower.
+ */
+constexpr int expectedScore(int difference)
+{
+    if (difference < 0) {
+        return 100 - expectedScore(-difference);
+    }
+    if (difference > MaxDifference) {
+        return 100;
+    }
+    return ExpectedScores[difference];
+}
+
+/*!
+ * Returns the rating difference for a score of \a percentage percent.
+ */
+constexpr int ratingDifference(int percentage)
+{
+    if (percentage < 50) {
+        return -RatingDifferences[50 - percentage];
+    }
+    return RatingDifferences[percentage - 50];
+}
+
+static_assert(expectedScore(0) == 50);
+static_assert(expectedScore(10) == 51);
+static_assert(expectedScore(-400) == 8);
+static_assert(expectedScore(736) == 100);
+static_assert(ratingDifference(75) == 193);
+static_assert(ratingDifference(25) == -193);
+
+/*!
+ * Returns the rating of the player at \a player for the tiebreaks, which is
+ * UnratedRating for unrated players.
+ */
+[[nodiscard]] int rating(const State &state, int player);
+
+/*!
+ * Returns the average rating of the opponents of \a player in the games played
+ * over the board, excluding the \a cutLowest lowest ratings, rounded to an integer.
+ */
+[[nodiscard]] int averageRatingOfOpponents(const State &state, int player, int cutLowest = 0);
+
+/*!
+ * Returns the tournament performance rating of \a player: the average rating of
+ * the opponents plus the rating difference of the percentage score in the games
+ * played over the board.
+ */
+[[nodiscard]] int tournamentPerformanceRating(const State &state, int player);
+
+/*!
+ * Returns the perfect tournament performance of \a player: the lowest rating whose
+ * expected score against the opponents of the games played over the board is at
+ * least the score of the player.
+ */
+[[nodiscard]] int perfectTournamentPerformance(const State &state, int player);
+}
@@ -4,16 +4,10 @@
 #include "playedblack.h"
 #include "state.h"
 
-double NumberOfGamesPlayedWithBlack::calculate(Tournament *tournament, State state, QList<Player *> players, Player *player)
+double NumberOfGamesPlayedWithBlack::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
 {
     Q_UNUSED(tournament)
     Q_UNUSED(players)
 
-    const auto pairings = state.pairings(player);
-
-    const auto result = std::ranges::count_if(pairings, [&player](Pairing *pairing) {
-        return pairing->colorOfPlayer(player) == Pairing::Color::Black && !Pairing::isUnplayed(pairing->resultOfPlayer(player));
-    });
-
-    return static_cast<double>(result);
+    return static_cast<double>(state.gamesWithBlack(State::index(player)));
 }
@@ -27,5 +27,10 @@ public:
         return "BPG"_L1;
     }
 
-    double calculate(Tournament *tournament, State state, QList<Player *> players, Player *player) override;
+    double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) override;
+
+    [[nodiscard]] std::optional<int> dependencyDepth() override
+    {
+        return 0;
+    }
 };
@@ -4,10 +4,10 @@
 #include "points.h"
 #include "state.h"
 
-double Points::calculate(Tournament *tournament, State state, QList<Player *> players, Player *player)
+double Points::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
 {
     Q_UNUSED(tournament)
     Q_UNUSED(players)
 
-    return state.points(player);
+    return state.points(State::index(player));
 }
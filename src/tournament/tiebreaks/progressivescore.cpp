@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#include "progressivescore.h"
+#include "state.h"
+
+QList<QVariantMap> ProgressiveScore::options()
+{
+    return {
+        {
+            {"id"_L1, "cut_first"_L1},
+            {"name"_L1, i18nc("@label:spinbox", "Exclude the first rounds:")},
+            {"type"_L1, "number"_L1},
+            {"value"_L1, option("cut_first"_L1, 0)},
+        },
+    };
+}
+
+std::expected<void, QString> ProgressiveScore::setTrfOptions(const QList<QString> &options)
+{
+    for (const auto &option : options) {
+        if (option.startsWith(u'C', Qt::CaseSensitivity::CaseInsensitive)) {
+            bool ok;
+            const int cutFirst = option.mid(1).toInt(&ok);
+            if (!ok || cutFirst <= 0) {
+                return std::unexpected(i18nc("@info", "Unsupported tiebreak option \"%1\"", option));
+            }
+            setOption("cut_first"_L1, cutFirst);
+        }
+    }
+
+    return {};
+}
+
+double ProgressiveScore::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
+{
+    Q_UNUSED(tournament)
+    Q_UNUSED(players)
+
+    const auto index = State::index(player);
+    const auto cutFirst = option("cut_first"_L1, 0).toInt();
+
+    double score = 0.;
+    double result = 0.;
+    for (int round = 0; round < state.lastRound(); ++round) {
+        if (state.hasPairing(index, round)) {
+            score += state.points(index, round);
+        }
+        if (round >= cutFirst) {
+            result += score;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#pragma once
+
+#include "tiebreak.h"
+
+#include <KLocalizedString>
+#include <QLocale>
+
+using namespace Qt::Literals::StringLiterals;
+
+// Sum of the scores of the player after each round
+class ProgressiveScore : public Tiebreak
+{
+public:
+    [[nodiscard]] QString id() override
+    {
+        return "ps"_L1;
+    }
+
+    [[nodiscard]] QString name() override
+    {
+        const auto cutFirst = option("cut_first"_L1, 0).toInt();
+        if (cutFirst == 0) {
+            return i18nc("Tiebreak", "Progressive Score");
+        }
+        const auto cutText = QLocale::system().toString(-cutFirst);
+        return i18nc("Progressive Score N tiebreak, N is a number < 0", "Progressive Score %1", cutText);
+    };
+
+    [[nodiscard]] QString code() override
+    {
+        const auto cutFirst = option("cut_first"_L1, 0).toInt();
+        if (cutFirst == 0) {
+            return "PS"_L1;
+        }
+        return "PS/C%1"_L1.arg(QString::number(cutFirst));
+    }
+
+    [[nodiscard]] bool isConfigurable() override
+    {
+        return true;
+    }
+
+    [[nodiscard]] QList<QVariantMap> options() override;
+
+    std::expected<void, QString> setTrfOptions(const QList<QString> &options) override;
+
+    double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) override;
+
+    [[nodiscard]] std::optional<int> dependencyDepth() override
+    {
+        return 0;
+    }
+};
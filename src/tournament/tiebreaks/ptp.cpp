@@ -0,0 +1,14 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#include "ptp.h"
+#include "performance.h"
+#include "state.h"
+
+double PerfectTournamentPerformance::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
+{
+    Q_UNUSED(tournament)
+    Q_UNUSED(players)
+
+    return Performance::perfectTournamentPerformance(state, State::index(player));
+}
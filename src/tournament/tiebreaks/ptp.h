@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#pragma once
+
+#include "tiebreak.h"
+
+#include <KLocalizedString>
+
+using namespace Qt::Literals::StringLiterals;
+
+class PerfectTournamentPerformance : public Tiebreak
+{
+public:
+    [[nodiscard]] QString id() override
+    {
+        return "ptp"_L1;
+    }
+
+    [[nodiscard]] QString name() override
+    {
+        return i18nc("Tiebreak", "Perfect Tournament Performance");
+    };
+
+    [[nodiscard]] QString code() override
+    {
+        return "PTP"_L1;
+    }
+
+    double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) override;
+
+    [[nodiscard]] std::optional<int> dependencyDepth() override
+    {
+        return 0;
+    }
+};
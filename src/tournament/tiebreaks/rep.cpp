@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#include "rep.h"
+#include "pairing.h"
+#include "state.h"
+
+double RoundsElectedToPlay::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
+{
+    Q_UNUSED(tournament)
+    Q_UNUSED(players)
+
+    const auto index = State::index(player);
+
+    int result = 0;
+    for (int round = 0; round < state.lastRound(); ++round) {
+        if (state.hasPairing(index, round) && !Pairing::isVUR(state.result(index, round))) {
+            ++result;
+        }
+    }
+
+    return static_cast<double>(result);
+}
@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#pragma once
+
+#include "opponentscores.h"
+
+#include <KLocalizedString>
+
+using namespace Qt::Literals::StringLiterals;
+
+class SonnebornBerger : public OpponentScoresTiebreak
+{
+public:
+    [[nodiscard]] QString id() override
+    {
+        return "sb"_L1;
+    }
+
+protected:
+    [[nodiscard]] QString baseName() override
+    {
+        return i18nc("Sonneborn-Berger tiebreak", "Sonneborn-Berger");
+    }
+
+    [[nodiscard]] QString baseCode() override
+    {
+        return "SB"_L1;
+    }
+
+    [[nodiscard]] double contribution(double opponentScore, double points) override
+    {
+        return opponentScore * points;
+    }
+};
@@ -28,6 +28,28 @@ QList<QVariantMap> Tiebreak::options()
     return {};
 }
 
+std::optional<int> Tiebreak::dependencyDepth()
+{
+    return std::nullopt;
+}
+
+std::vector<double> Tiebreak::calculateGroup(Tournament *tournament, const State &state, const QList<Player *> &players)
+{
+    std::vector<double> values;
+    values.reserve(players.size());
+
+    for (const auto player : players) {
+        values.push_back(calculate(tournament, state, players, player));
+    }
+
+    return values;
+}
+
+Tiebreak::Aggregates Tiebreak::aggregates()
+{
+    return {};
+}
+
 void Tiebreak::setOption(const QString &key, const QVariant &value)
 {
     m_options[key] = value;
@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <QFlags>
 #include <QList>
 #include <QVariant>
 
 #include <expected>
+#include <optional>
+#include <vector>
 
 class Tournament;
 class Player;
@@ -15,6 +18,15 @@ class State;
 class Tiebreak
 {
 public:
+    // Per-player values computed by the State that a tiebreak reads, so they can
+    // be computed for all the players before the tiebreak is calculated
+    enum class Aggregate {
+        Buchholz = 0x1,
+        OpponentScores = 0x2,
+        ForeOpponentScores = 0x4,
+    };
+    Q_DECLARE_FLAGS(Aggregates, Aggregate)
+
     Tiebreak() = default;
 
     virtual ~Tiebreak() = default;
@@ -41,10 +53,25 @@ public:
 
     virtual std::expected<void, QString> setTrfOptions(const QList<QString> &options);
 
-    virtual double calculate(Tournament *tournament, State state, QList<Player *> players, Player *player) = 0;
+    virtual double calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player) = 0;
+
+    // Calculates the tiebreak of all the players of a group of tied players, in the
+    // same order. Tiebreaks depending on the tied players can override it to compute
+    // the values shared by the group only once.
+    [[nodiscard]] virtual std::vector<double> calculateGroup(Tournament *tournament, const State &state, const QList<Player *> &players);
+
+    // Distance in the graph of opponents up to which a result changes the value
+    // of this tiebreak: 0 if it only depends on the games of the player, 1 if it
+    // also depends on the games of their opponents, and so on. std::nullopt if it
+    // depends on the tied players.
+    [[nodiscard]] virtual std::optional<int> dependencyDepth();
+
+    [[nodiscard]] virtual Aggregates aggregates();
 
     QJsonObject toJson();
 
 private:
     QVariantMap m_options;
 };
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(Tiebreak::Aggregates)
@@ -6,11 +6,21 @@
 #include <QJsonArray>
 
 #include "tiebreaks/aob.h"
+#include "tiebreaks/apro.h"
+#include "tiebreaks/aro.h"
 #include "tiebreaks/buchholz.h"
+#include "tiebreaks/directencounter.h"
 #include "tiebreaks/dummy.h"
+#include "tiebreaks/forebuchholz.h"
+#include "tiebreaks/koya.h"
 #include "tiebreaks/numberwins.h"
 #include "tiebreaks/playedblack.h"
 #include "tiebreaks/points.h"
+#include "tiebreaks/progressivescore.h"
+#include "tiebreaks/ptp.h"
+#include "tiebreaks/rep.h"
+#include "tiebreaks/sonnebornberger.h"
+#include "tiebreaks/tpr.h"
 #include "tiebreaks/won.h"
 #include "utils.h"
 
@@ -57,6 +67,36 @@ std::unique_ptr<Tiebreak> Tiebreaks::at(int index) const
     return tiebreak;
 }
 
+const std::vector<std::shared_ptr<Tiebreak>> &Tiebreaks::compiled() const
+{
+    return m_compiled;
+}
+
+Tiebreak::Aggregates Tiebreaks::aggregates() const
+{
+    return m_aggregates;
+}
+
+Tiebreak::Aggregates Tiebreaks::aggregates(const std::vector<std::shared_ptr<Tiebreak>> &tiebreaks)
+{
+    Tiebreak::Aggregates aggregates;
+    for (const auto &tiebreak : tiebreaks) {
+        aggregates |= tiebreak->aggregates();
+    }
+
+    return aggregates;
+}
+
+void Tiebreaks::compile()
+{
+    m_compiled.clear();
+    for (auto &tiebreak : all()) {
+        m_compiled.push_back(std::move(tiebreak));
+    }
+
+    m_aggregates = aggregates(m_compiled);
+}
+
 void Tiebreaks::addTiebreak(std::unique_ptr<Tiebreak> arbiter)
 {
     auto value = m_json["tiebreaks"_L1];
@@ -68,6 +108,8 @@ void Tiebreaks::addTiebreak(std::unique_ptr<Tiebreak> arbiter)
 
     tiebreaks << arbiter->toJson();
     value = tiebreaks;
+
+    compile();
 }
 
 void Tiebreaks::setTiebreak(int index, std::unique_ptr<Tiebreak> arbiter)
@@ -85,6 +127,8 @@ void Tiebreaks::setTiebreak(int index, std::unique_ptr<Tiebreak> arbiter)
     tiebreaks[index] = json;
 
     value = tiebreaks;
+
+    compile();
 }
 
 void Tiebreaks::swapTiebreaks(int a, int b)
@@ -103,6 +147,8 @@ void Tiebreaks::swapTiebreaks(int a, int b)
     tiebreaks.insert(b, tiebreak);
 
     value = tiebreaks;
+
+    compile();
 }
 
 void Tiebreaks::removeTiebreak(int index)
@@ -118,6 +164,8 @@ void Tiebreaks::removeTiebreak(int index)
     tiebreaks.erase(tiebreaks.begin() + index);
 
     value = tiebreaks;
+
+    compile();
 }
 
 QJsonObject Tiebreaks::toJson() const
@@ -129,6 +177,7 @@ Tiebreaks Tiebreaks::fromJson(const QJsonObject &json)
 {
     Tiebreaks tiebreaks;
     tiebreaks.m_json = json;
+    tiebreaks.compile();
     return tiebreaks;
 }
 
@@ -152,6 +201,36 @@ std::unique_ptr<Tiebreak> Tiebreaks::tiebreak(const QString &id)
     if (id == "aob"_L1) {
         return std::make_unique<AverageBuchholzOfOpponents>();
     }
+    if (id == "sb"_L1) {
+        return std::make_unique<SonnebornBerger>();
+    }
+    if (id == "fb"_L1) {
+        return std::make_unique<ForeBuchholz>();
+    }
+    if (id == "aro"_L1) {
+        return std::make_unique<AverageRatingOfOpponents>();
+    }
+    if (id == "tpr"_L1) {
+        return std::make_unique<TournamentPerformanceRating>();
+    }
+    if (id == "ptp"_L1) {
+        return std::make_unique<PerfectTournamentPerformance>();
+    }
+    if (id == "apro"_L1) {
+        return std::make_unique<AveragePerformanceRatingOfOpponents>();
+    }
+    if (id == "de"_L1) {
+        return std::make_unique<DirectEncounter>();
+    }
+    if (id == "ps"_L1) {
+        return std::make_unique<ProgressiveScore>();
+    }
+    if (id == "ks"_L1) {
+        return std::make_unique<KoyaSystem>();
+    }
+    if (id == "rep"_L1) {
+        return std::make_unique<RoundsElectedToPlay>();
+    }
     return nullptr;
 }
 
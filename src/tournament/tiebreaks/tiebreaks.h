@@ -7,13 +7,25 @@
 
 #include <QJsonObject>
 
+#include <memory>
+#include <vector>
+
 struct Tiebreaks {
     [[nodiscard]] int size() const;
 
+    // Returns new tiebreak objects, which can be modified and passed to setTiebreak()
     [[nodiscard]] std::vector<std::unique_ptr<Tiebreak>> all() const;
 
     [[nodiscard]] std::unique_ptr<Tiebreak> at(int index) const;
 
+    // Returns the tiebreaks with their options already read. They are built every time
+    // the tiebreaks change, so the returned reference is only valid until then. Code
+    // running in other threads must work on a copy of the vector made beforehand.
+    [[nodiscard]] const std::vector<std::shared_ptr<Tiebreak>> &compiled() const;
+
+    // Returns the aggregates needed by the tiebreaks
+    [[nodiscard]] Tiebreak::Aggregates aggregates() const;
+
     void addTiebreak(std::unique_ptr<Tiebreak> arbiter);
 
     void setTiebreak(int index, std::unique_ptr<Tiebreak> arbiter);
@@ -32,6 +44,14 @@ struct Tiebreaks {
 
     static std::expected<std::unique_ptr<Tiebreak>, QString> tiebreakFromTrf(const QString &code);
 
+    // Returns the aggregates needed by \a tiebreaks
+    static Tiebreak::Aggregates aggregates(const std::vector<std::shared_ptr<Tiebreak>> &tiebreaks);
+
 private:
+    void compile();
+
     QJsonObject m_json;
+
+    std::vector<std::shared_ptr<Tiebreak>> m_compiled;
+    Tiebreak::Aggregates m_aggregates;
 };
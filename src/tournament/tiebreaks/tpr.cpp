@@ -0,0 +1,14 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+
+#include "tpr.h"
+#include "performance.h"
+#include "state.h"
+
+double TournamentPerformanceRating::calculate(Tournament *tournament, const State &state, const QList<Player *> &players, Player *player)
+{
+    Q_UNUSED(tournament)
+    Q_UNUSED(players)
+
+    return Performance::tournamentPerformanceRating(state, State::index(player));
+}
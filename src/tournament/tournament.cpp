@@ -7,28 +7,41 @@
 #include <QSqlError>
 #include <QSqlQuery>
 #include <QSqlRecord>
+#include <QtConcurrentMap>
 
 #include <algorithm>
 
 #include "db.h"
 #include "event.h"
 #include "pairing.h"
+#include "pairings/bbppairingsbackend.h"
+#include "pairings/pairingbackend.h"
+#include "pairings/pairingcache.h"
+#include "pairings/pairingsnapshot.h"
+#include "pairings/speculativepairing.h"
 #include "ratinglists/ratinglist.h"
 #include "ratinglists/ratinglistsmanager.h"
 #include "state.h"
+#include "statementcache.h"
 #include "tiebreaks/points.h"
 #include "timecontrol.h"
 #include "trf/reader.h"
 #include "trf/writer.h"
+#include "unitofwork.h"
 #include "utils.h"
 
 Tournament::Tournament(Event *event)
     : m_event(event)
     , m_timeControl({TimeControlPeriod{std::nullopt, 5400, 30}})
+    , m_speculation(new SpeculativePairing(this))
 {
+    m_speculation->setMaxThreads(m_speculativePairingThreads);
+    m_speculation->setMaxScenarios(m_speculativePairingScenarios);
     m_tiebreaks.addTiebreak(std::make_unique<Points>());
 }
 
+Tournament::~Tournament() = default;
+
 QString Tournament::id() const
 {
     return m_id;
@@ -174,6 +187,108 @@ void Tournament::setCurrentRound(int currentRound)
     Q_EMIT currentRoundChanged();
 }
 
+Tournament::PairingSystem Tournament::pairingSystem() const
+{
+    return m_pairingSystem;
+}
+
+bool Tournament::isRoundRobin() const
+{
+    return m_pairingSystem == PairingSystem::RoundRobin || m_pairingSystem == PairingSystem::DoubleRoundRobin;
+}
+
+void Tournament::setPairingSystem(Tournament::PairingSystem pairingSystem)
+{
+    if (m_pairingSystem == pairingSystem) {
+        return;
+    }
+    m_pairingSystem = pairingSystem;
+    setOption(u"pairing_system"_s, std::to_underlying(pairingSystem));
+    Q_EMIT pairingSystemChanged();
+}
+
+Tournament::PairingEngine Tournament::pairingEngine() const
+{
+    return m_pairingEngine;
+}
+
+void Tournament::setPairingEngine(Tournament::PairingEngine pairingEngine)
+{
+    if (m_pairingEngine == pairingEngine) {
+        return;
+    }
+    m_pairingEngine = pairingEngine;
+    setOption(u"pairing_engine"_s, std::to_underlying(pairingEngine));
+    Q_EMIT pairingEngineChanged();
+}
+
+bool Tournament::crossCheckPairings() const
+{
+    return m_crossCheckPairings;
+}
+
+void Tournament::setCrossCheckPairings(bool crossCheckPairings)
+{
+    if (m_crossCheckPairings == crossCheckPairings) {
+        return;
+    }
+    m_crossCheckPairings = crossCheckPairings;
+    setOption(u"cross_check_pairings"_s, crossCheckPairings);
+    Q_EMIT crossCheckPairingsChanged();
+}
+
+bool Tournament::speculativePairing() const
+{
+    return m_speculativePairing;
+}
+
+void Tournament::setSpeculativePairing(bool speculativePairing)
+{
+    if (m_speculativePairing == speculativePairing) {
+        return;
+    }
+    m_speculativePairing = speculativePairing;
+    setOption(u"speculative_pairing"_s, speculativePairing);
+
+    if (!speculativePairing) {
+        m_speculation->clear();
+    }
+
+    Q_EMIT speculativePairingChanged();
+}
+
+int Tournament::speculativePairingThreads() const
+{
+    return m_speculativePairingThreads;
+}
+
+void Tournament::setSpeculativePairingThreads(int threads)
+{
+    if (m_speculativePairingThreads == threads) {
+        return;
+    }
+    m_speculativePairingThreads = threads;
+    setOption(u"speculative_pairing_threads"_s, threads);
+    m_speculation->setMaxThreads(threads);
+    Q_EMIT speculativePairingThreadsChanged();
+}
+
+int Tournament::speculativePairingScenarios() const
+{
+    return m_speculativePairingScenarios;
+}
+
+void Tournament::setSpeculativePairingScenarios(int scenarios)
+{
+    if (m_speculativePairingScenarios == scenarios) {
+        return;
+    }
+    m_speculativePairingScenarios = scenarios;
+    setOption(u"speculative_pairing_scenarios"_s, scenarios);
+    m_speculation->setMaxScenarios(scenarios);
+    Q_EMIT speculativePairingScenariosChanged();
+}
+
 QList<Player *> Tournament::players() const
 {
     QList<Player *> result;
@@ -192,26 +307,29 @@ std::expected<void, QString> Tournament::addPlayer(std::unique_ptr<Player> playe
 
     player->setId(QUuid::createUuid().toString(QUuid::StringFormat::WithoutBraces));
 
-    QSqlQuery query(m_event->db());
-    query.prepare(ADD_PLAYER_QUERY);
-    query.bindValue(u":id"_s, player->id());
-    query.bindValue(u":startingRank"_s, player->startingRank());
-    query.bindValue(u":title"_s, player->title());
-    query.bindValue(u":name"_s, player->name());
-    query.bindValue(u":rating"_s, player->rating());
-    query.bindValue(u":nationalRating"_s, player->nationalRating());
-    query.bindValue(u":playerId"_s, player->playerId());
-    query.bindValue(u":nationalId"_s, player->nationalId());
-    query.bindValue(u":birthDate"_s, player->birthDate());
-    query.bindValue(u":federation"_s, player->federation());
-    query.bindValue(u":origin"_s, player->origin());
-    query.bindValue(u":gender"_s, player->gender());
-    query.bindValue(u":extra"_s, player->extraString());
-    query.bindValue(u":tournament"_s, m_id);
+    auto query = m_event->statements().statement(ADD_PLAYER_QUERY);
+    if (!query) {
+        return std::unexpected(query.error());
+    }
 
-    if (!query.exec()) {
-        qDebug() << "add player" << *player << query.lastError();
-        return std::unexpected(query.lastError().text());
+    query->bindValue(u":id"_s, player->id());
+    query->bindValue(u":startingRank"_s, player->startingRank());
+    query->bindValue(u":title"_s, player->title());
+    query->bindValue(u":name"_s, player->name());
+    query->bindValue(u":rating"_s, player->rating());
+    query->bindValue(u":nationalRating"_s, player->nationalRating());
+    query->bindValue(u":playerId"_s, player->playerId());
+    query->bindValue(u":nationalId"_s, player->nationalId());
+    query->bindValue(u":birthDate"_s, player->birthDate());
+    query->bindValue(u":federation"_s, player->federation());
+    query->bindValue(u":origin"_s, player->origin());
+    query->bindValue(u":gender"_s, player->gender());
+    query->bindValue(u":extra"_s, player->extraString());
+    query->bindValue(u":tournament"_s, m_id);
+
+    if (!query->exec()) {
+        qDebug() << "add player" << *player << query->lastError();
+        return std::unexpected(query->lastError().text());
     }
 
     std::vector<std::unique_ptr<Pairing>> pairings;
@@ -238,6 +356,8 @@ std::expected<void, QString> Tournament::addPlayer(std::unique_ptr<Player> playe
         round->addPairing(std::move(pairing));
     }
 
+    clearHistory();
+
     Q_EMIT numberOfPlayersChanged();
     Q_EMIT numberOfRatedPlayersChanged();
 
@@ -259,20 +379,29 @@ std::expected<void, QString> Tournament::deletePlayer(int startingRank)
         return ok;
     }
 
-    QSqlQuery query(m_event->db());
-    query.prepare(DELETE_PLAYER_QUERY);
-    query.bindValue(":id"_L1, player->id());
+    auto query = m_event->statements().statement(DELETE_PLAYER_QUERY);
+    if (!query) {
+        return std::unexpected(query.error());
+    }
 
-    if (!query.exec()) {
-        return std::unexpected(query.lastError().text());
+    query->bindValue(":id"_L1, player->id());
+
+    if (!query->exec()) {
+        return std::unexpected(query->lastError().text());
     }
 
     m_players.erase(m_players.begin() + startingRank - 1);
+    clearHistory();
 
+    UnitOfWork work(m_event->statements(), m_id);
     for (int i = startingRank - 1; i < static_cast<int>(m_players.size()); ++i) {
         const auto &player = m_players.at(i);
         player->setStartingRank(i + 1);
-        savePlayer(player.get());
+        work.addPlayer(player.get());
+    }
+
+    if (const auto ok = work.write(); !ok) {
+        return ok;
     }
 
     if (!m_event->db().commit()) {
@@ -287,28 +416,36 @@ std::expected<void, QString> Tournament::deletePlayer(int startingRank)
 
 void Tournament::savePlayer(Player *player)
 {
-    QSqlQuery query(m_event->db());
-    query.prepare(UPDATE_PLAYER_QUERY);
-    query.bindValue(u":id"_s, player->id());
-    query.bindValue(u":startingRank"_s, player->startingRank());
-    query.bindValue(u":title"_s, player->title());
-    query.bindValue(u":name"_s, player->name());
-    query.bindValue(u":rating"_s, player->rating());
-    query.bindValue(u":nationalRating"_s, player->nationalRating());
-    query.bindValue(u":playerId"_s, player->playerId());
-    query.bindValue(u":nationalId"_s, player->nationalId());
-    query.bindValue(u":birthDate"_s, player->birthDate());
-    query.bindValue(u":federation"_s, player->federation());
-    query.bindValue(u":origin"_s, player->origin());
-    query.bindValue(u":gender"_s, player->gender());
-    query.bindValue(u":extra"_s, player->extraString());
-    query.bindValue(u":tournament"_s, m_id);
+    UnitOfWork work(m_event->statements(), m_id);
+    work.addPlayer(player);
 
-    if (!query.exec()) {
-        qDebug() << "save player" << *player << query.lastError();
+    if (const auto ok = work.write(); !ok) {
+        qDebug() << "save player" << *player << ok.error();
+    }
+
+    // The starting rank may have changed
+    clearHistory();
+
+    Q_EMIT numberOfRatedPlayersChanged();
+}
+
+std::expected<void, QString> Tournament::savePlayers(UnitOfWork &work)
+{
+    if (work.isEmpty()) {
+        return {};
+    }
+
+    const auto ok = work.flush();
+    if (!ok) {
+        qDebug() << "save players" << ok.error();
     }
 
+    // The starting ranks may have changed
+    clearHistory();
+
     Q_EMIT numberOfRatedPlayersChanged();
+
+    return ok;
 }
 
 void Tournament::sortPlayers()
@@ -324,15 +461,20 @@ void Tournament::sortPlayers()
         return p1->rating() > p2->rating();
     });
 
+    UnitOfWork work(m_event->statements(), m_id);
     for (int i = 0; i < static_cast<int>(m_players.size()); i++) {
         auto *player = m_players.at(i).get();
         player->setStartingRank(i + 1);
-        savePlayer(player);
+        work.addPlayer(player);
     }
+
+    savePlayers(work);
 }
 
 void Tournament::updateRatings(int listId)
 {
+    UnitOfWork work(m_event->statements(), m_id);
+
     const auto &players = m_players;
     for (const auto &player : players) {
         const auto listPlayer = RatingListsManager::searchPlayer(player->playerId(), listId);
@@ -348,8 +490,10 @@ void Tournament::updateRatings(int listId)
         player->setRating(listPlayer->standardRating());
         player->setNationalRating(listPlayer->nationalRating());
 
-        savePlayer(player.get());
+        work.addPlayer(player.get());
     }
+
+    savePlayers(work);
 }
 
 int Tournament::changePlayerStartingRank(Player *player, int startingRank)
@@ -362,19 +506,23 @@ int Tournament::changePlayerStartingRank(Player *player, int startingRank)
         return rank;
     }
 
+    UnitOfWork work(m_event->statements(), m_id);
+
     const auto &players = m_players;
     for (const auto &p : players) {
         if (p->startingRank() >= rank && p->startingRank() < player->startingRank()) {
             p->setStartingRank(p->startingRank() + 1);
-            savePlayer(p.get());
+            work.addPlayer(p.get());
         } else if (p->startingRank() > player->startingRank() && p->startingRank() <= rank) {
             p->setStartingRank(p->startingRank() - 1);
-            savePlayer(p.get());
+            work.addPlayer(p.get());
         }
     }
 
     player->setStartingRank(rank);
-    savePlayer(player);
+    work.addPlayer(player);
+
+    savePlayers(work);
 
     return rank;
 }
@@ -448,20 +596,17 @@ QList<Pairing *> Tournament::pairingsOfPlayer(Player *player)
 }
 
 QList<Standing> Tournament::standings(const State &state)
+{
+    return standings(state, m_tiebreaks.compiled());
+}
+
+QList<Standing> Tournament::standings(const State &state, const std::vector<std::shared_ptr<Tiebreak>> &tiebreaks)
 {
     QList<Standing> standings;
 
     // Sort by tiebreaks
     auto sortStandings = [&standings]() {
-        std::ranges::sort(standings, [](const Standing &p1, const Standing &p2) {
-            for (size_t i = 0; i < p1.values().size(); i++) {
-                if (p1.values().at(i) == p2.values().at(i)) {
-                    continue;
-                }
-                return p1.values().at(i) > p2.values().at(i);
-            }
-            return p1.player()->startingRank() < p2.player()->startingRank();
-        });
+        std::ranges::sort(standings, Standing::isBefore);
     };
 
     for (const auto &player : std::as_const(m_players)) {
@@ -469,42 +614,71 @@ QList<Standing> Tournament::standings(const State &state)
     }
 
     // Calculate tiebreaks
-    QList<Player *> players;
-    for (const auto &tiebreak : m_tiebreaks.all()) {
-        uint i = 0;
-        players.clear();
-        while (i < m_players.size()) {
-            if (players.isEmpty()) {
-                players << standings.at(i).player();
-                i++;
+    state.precompute(Tiebreaks::aggregates(tiebreaks));
+
+    // Players of a group of tied players whose tiebreaks are calculated by
+    // the same task. Tiebreaks depending on the tied players get the whole
+    // group in one task.
+    struct Chunk {
+        qsizetype group;
+        qsizetype groupBegin;
+        qsizetype begin;
+        qsizetype end;
+    };
+    constexpr qsizetype chunkSize = 32;
+
+    QList<QList<Player *>> groups;
+    std::vector<Chunk> chunks;
+    std::vector<double> values(standings.size());
+
+    for (const auto &tiebreak : tiebreaks) {
+        const bool byGroup = !tiebreak->dependencyDepth().has_value();
+
+        groups.clear();
+        chunks.clear();
+
+        qsizetype begin = 0;
+        for (qsizetype i = 1; i <= standings.size(); ++i) {
+            if (i < standings.size() && standings.at(i - 1).key() == standings.at(i).key()) {
                 continue;
             }
-            if (standings.at(i - 1).values() == standings.at(i).values()) {
-                players << standings.at(i).player();
-                i++;
+
+            QList<Player *> group;
+            group.reserve(i - begin);
+            for (auto j = begin; j < i; ++j) {
+                group << standings.at(j).player();
+            }
+
+            if (byGroup) {
+                chunks.push_back({groups.size(), begin, begin, i});
             } else {
-                for (int j = 0; j < players.size(); j++) {
-                    /*for (const auto &p : players) {
-                        qDebug() << p->name();
-                    }
-                    qDebug() << "Player" << j << "is" << players.at(j)->name();
-                    qDebug() << "SPlayer" << j << "is" << standings.at(i - players.size() + j).first->name();
-                    qDebug() << "--";*/
-                    standings[i - players.size() + j].addValue(tiebreak->calculate(this, state, players, players.at(j)));
+                for (auto j = begin; j < i; j += chunkSize) {
+                    chunks.push_back({groups.size(), begin, j, std::min(j + chunkSize, i)});
                 }
-                players.clear();
-                players << standings.at(i).player();
-                i++;
             }
+
+            groups << group;
+            begin = i;
         }
-        for (int j = 0; j < players.size(); j++) {
-            /*for (const auto &p : players) {
-                qDebug() << p->name();
+
+        // Each task writes the values of its own players, so the result does not
+        // depend on the order the tasks are run in
+        QtConcurrent::blockingMap(&m_standingsPool, chunks, [this, &state, &tiebreak, &groups, &values, byGroup](const Chunk &chunk) {
+            const auto &group = std::as_const(groups).at(chunk.group);
+            if (byGroup) {
+                const auto groupValues = tiebreak->calculateGroup(this, state, group);
+                Q_ASSERT(std::ssize(groupValues) == group.size());
+                std::ranges::copy(groupValues, values.begin() + chunk.groupBegin);
+                return;
+            }
+
+            for (auto j = chunk.begin; j < chunk.end; ++j) {
+                values[j] = tiebreak->calculate(this, state, group, group.at(j - chunk.groupBegin));
             }
-            qDebug() << "Player" << j << "is" << players.at(j)->name();
-            qDebug() << "SPlayer" << j << "is" << standings.at(i - players.size() + j).first->name();
-            qDebug() << "--";*/
-            standings[i - players.size() + j].addValue(tiebreak->calculate(this, state, players, players.at(j)));
+        });
+
+        for (qsizetype i = 0; i < standings.size(); ++i) {
+            standings[i].addValue(values[i]);
         }
         sortStandings();
     }
@@ -512,7 +686,7 @@ QList<Standing> Tournament::standings(const State &state)
     // Calculate ranks
     for (int i = 1; i < standings.size(); ++i) {
         auto &standing = standings[i];
-        if (standing.values() == standings.at(i - 1).values()) {
+        if (standing.key() == standings.at(i - 1).key()) {
             standing.setRank(standings.at(i - 1).rank());
         } else {
             standing.setRank(i + 1);
@@ -522,6 +696,33 @@ QList<Standing> Tournament::standings(const State &state)
     return standings;
 }
 
+QList<QList<Standing>> Tournament::standingsHistory(std::optional<int> maxRound)
+{
+    return standingsHistory(maxRound, m_tiebreaks.compiled());
+}
+
+QList<QList<Standing>> Tournament::standingsHistory(std::optional<int> maxRound, const std::vector<std::shared_ptr<Tiebreak>> &tiebreaks)
+{
+    const auto state = this->state(maxRound);
+    const auto aggregates = Tiebreaks::aggregates(tiebreaks);
+
+    QList<QList<Standing>> history;
+    history.reserve(state.lastRound());
+
+    auto previous = state.cutOff(0);
+    for (int round = 1; round <= state.lastRound(); ++round) {
+        auto current = state.cutOff(round);
+
+        // standings() finds the aggregates already cached
+        current.precompute(aggregates, previous);
+        history << standings(current, tiebreaks);
+
+        previous = std::move(current);
+    }
+
+    return history;
+}
+
 QList<QVariantMap> Tournament::availableTiebreaks()
 {
     return {
@@ -551,6 +752,46 @@ QList<QVariantMap> Tournament::availableTiebreaks()
             {"id"_L1, "aob"_L1},
             {"name"_L1, i18nc("Tiebreak", "Average Buchholz of Opponents")},
         },
+        {
+            {"id"_L1, "sb"_L1},
+            {"name"_L1, i18nc("Sonneborn-Berger tiebreak", "Sonneborn-Berger")},
+        },
+        {
+            {"id"_L1, "fb"_L1},
+            {"name"_L1, i18nc("Fore Buchholz tiebreak", "Fore Buchholz")},
+        },
+        {
+            {"id"_L1, "aro"_L1},
+            {"name"_L1, i18nc("Tiebreak", "Average Rating of Opponents")},
+        },
+        {
+            {"id"_L1, "tpr"_L1},
+            {"name"_L1, i18nc("Tiebreak", "Tournament Performance Rating")},
+        },
+        {
+            {"id"_L1, "ptp"_L1},
+            {"name"_L1, i18nc("Tiebreak", "Perfect Tournament Performance")},
+        },
+        {
+            {"id"_L1, "apro"_L1},
+            {"name"_L1, i18nc("Tiebreak", "Average Performance Rating of Opponents")},
+        },
+        {
+            {"id"_L1, "de"_L1},
+            {"name"_L1, i18nc("Tiebreak", "Direct Encounter")},
+        },
+        {
+            {"id"_L1, "ps"_L1},
+            {"name"_L1, i18nc("Tiebreak", "Progressive Score")},
+        },
+        {
+            {"id"_L1, "ks"_L1},
+            {"name"_L1, i18nc("Tiebreak", "Koya System")},
+        },
+        {
+            {"id"_L1, "rep"_L1},
+            {"name"_L1, i18nc("Tiebreak", "Rounds Elected to Play")},
+        },
     };
 }
 
@@ -581,17 +822,20 @@ std::expected<void, QString> Tournament::ensureRoundExists(int round)
         for (size_t i = m_rounds.size() + 1; i <= static_cast<size_t>(round); ++i) {
             auto round = std::make_unique<Round>();
 
-            QSqlQuery query(m_event->db());
-            query.prepare(ADD_ROUND_QUERY);
-            query.bindValue(u":number"_s, static_cast<qulonglong>(i));
-            query.bindValue(u":tournament"_s, m_id);
-            query.bindValue(u":extra"_s, round->extraString());
+            auto query = m_event->statements().statement(ADD_ROUND_QUERY);
+            if (!query) {
+                return std::unexpected(query.error());
+            }
 
-            if (!query.exec()) {
-                return std::unexpected(query.lastError().text());
+            query->bindValue(u":number"_s, static_cast<qulonglong>(i));
+            query->bindValue(u":tournament"_s, m_id);
+            query->bindValue(u":extra"_s, round->extraString());
+
+            if (!query->exec()) {
+                return std::unexpected(query->lastError().text());
             }
 
-            round->setId(query.lastInsertId().toInt());
+            round->setId(query->query().lastInsertId().toInt());
             round->setNumber(int(i));
 
             m_rounds.push_back(std::move(round));
@@ -603,17 +847,12 @@ std::expected<void, QString> Tournament::ensureRoundExists(int round)
 
 std::expected<void, QString> Tournament::saveRound(Round *round)
 {
-    const auto dateTime = round->dateTime().toUTC().toString(Qt::ISODate);
-
-    QSqlQuery query(m_event->db());
-    query.prepare(UPDATE_ROUND_QUERY);
-    query.bindValue(u":id"_s, round->id());
-    query.bindValue(u":datetime"_s, dateTime);
-    query.bindValue(u":extra"_s, round->extraString());
+    UnitOfWork work(m_event->statements(), m_id);
+    work.addRound(round);
 
-    if (!query.exec()) {
-        qDebug() << "save round" << query.lastError();
-        return std::unexpected(query.lastError().text());
+    if (const auto ok = work.write(); !ok) {
+        qDebug() << "save round" << ok.error();
+        return ok;
     }
 
     return {};
@@ -646,45 +885,45 @@ std::expected<void, QString> Tournament::savePairing(Pairing *pairing, int round
 {
     Q_ASSERT(roundNumber >= 0);
 
-    QSqlQuery query(m_event->db());
+    pairing->setLastModified(QDateTime::currentDateTimeUtc());
 
-    if (pairing->id().isEmpty()) {
-        Q_ASSERT(roundNumber >= 1);
+    if (!pairing->id().isEmpty()) {
+        UnitOfWork work(m_event->statements(), m_id);
+        work.addPairing(pairing);
 
-        if (const auto ok = ensureRoundExists(roundNumber); !ok) {
+        if (const auto ok = work.write(); !ok) {
+            qDebug() << "save pairing" << ok.error();
             return ok;
         }
 
-        const auto round = this->round(roundNumber);
-
-        pairing->setId(QUuid::createUuid().toString(QUuid::WithoutBraces));
+        updateHistory(pairing);
 
-        query.prepare(ADD_PAIRING_QUERY);
-        query.bindValue(u":round"_s, round->id());
-    } else {
-        query.prepare(UPDATE_PAIRING_QUERY);
+        return {};
     }
 
-    pairing->setLastModified(QDateTime::currentDateTimeUtc());
+    Q_ASSERT(roundNumber >= 1);
 
-    query.bindValue(u":id"_s, pairing->id());
-    query.bindValue(u":board"_s, pairing->board());
-    query.bindValue(u":whitePlayer"_s, pairing->whitePlayer()->id());
-    if (pairing->blackPlayer() != nullptr) {
-        query.bindValue(u":blackPlayer"_s, pairing->blackPlayer()->id());
-    } else {
-        query.bindValue(u":blackPlayer"_s, QVariant(QMetaType::fromType<QString>()));
+    if (const auto ok = ensureRoundExists(roundNumber); !ok) {
+        return ok;
     }
-    query.bindValue(u":whiteResult"_s, std::to_underlying(pairing->whiteResult()));
-    query.bindValue(u":blackResult"_s, std::to_underlying(pairing->blackResult()));
-    query.bindValue(u":lastModified"_s, pairing->lastModified().toSecsSinceEpoch());
-    query.bindValue(u":extra"_s, pairing->extraString());
 
-    if (!query.exec()) {
-        qDebug() << "save pairing" << query.lastError();
-        return std::unexpected(query.lastError().text());
+    auto query = m_event->statements().statement(ADD_PAIRING_QUERY);
+    if (!query) {
+        return std::unexpected(query.error());
     }
 
+    pairing->setId(QUuid::createUuid().toString(QUuid::WithoutBraces));
+
+    query->bindValue(u":round"_s, this->round(roundNumber)->id());
+    UnitOfWork::bindPairing(*query, pairing);
+
+    if (!query->exec()) {
+        qDebug() << "save pairing" << query->lastError();
+        return std::unexpected(query->lastError().text());
+    }
+
+    updateHistory(pairing);
+
     return {};
 }
 
@@ -696,6 +935,12 @@ std::expected<void, QString> Tournament::setResult(Pairing *pairing, Pairing::Re
         return ok;
     }
 
+    Q_EMIT resultChanged(pairing);
+
+    if (m_speculativePairing) {
+        m_speculation->update(this);
+    }
+
     return {};
 }
 
@@ -802,6 +1047,10 @@ std::expected<void, QString> Tournament::sortPairings(std::optional<int> round)
     const auto firstRound = round ? *round - 1 : 0;
     const auto lastRound = round ? *round : m_rounds.size();
 
+    // The boards of all the rounds are saved at once
+    UnitOfWork work(m_event->statements(), m_id);
+    const auto now = QDateTime::currentDateTimeUtc();
+
     for (size_t i = firstRound; i < lastRound; i++) {
         auto &pairings = m_rounds[i]->m_pairings;
 
@@ -852,20 +1101,20 @@ std::expected<void, QString> Tournament::sortPairings(std::optional<int> round)
             double aScore;
             double aTotal;
             if (a->whitePlayer()->startingRank() < a->blackPlayer()->startingRank()) {
-                aScore = state.points(a->whitePlayer());
-                aTotal = aScore + state.points(a->blackPlayer());
+                aScore = state.points(State::index(a->whitePlayer()));
+                aTotal = aScore + state.points(State::index(a->blackPlayer()));
             } else {
-                aScore = state.points(a->blackPlayer());
-                aTotal = aScore + state.points(a->whitePlayer());
+                aScore = state.points(State::index(a->blackPlayer()));
+                aTotal = aScore + state.points(State::index(a->whitePlayer()));
             }
             double bScore;
             double bTotal;
             if (b->whitePlayer()->startingRank() < b->blackPlayer()->startingRank()) {
-                bScore = state.points(b->whitePlayer());
-                bTotal = bScore + state.points(b->blackPlayer());
+                bScore = state.points(State::index(b->whitePlayer()));
+                bTotal = bScore + state.points(State::index(b->blackPlayer()));
             } else {
-                bScore = state.points(b->blackPlayer());
-                bTotal = bScore + state.points(b->whitePlayer());
+                bScore = state.points(State::index(b->blackPlayer()));
+                bTotal = bScore + state.points(State::index(b->whitePlayer()));
             }
 
             if (i > 0) {
@@ -884,15 +1133,18 @@ std::expected<void, QString> Tournament::sortPairings(std::optional<int> round)
 
         for (size_t i = 0; i < pairings.size(); i++) {
             pairings.at(i)->setBoard(static_cast<int>(i) + 1);
-
-            if (auto ok = savePairing(pairings[i].get()); !ok) {
-                return ok;
-            }
+            pairings.at(i)->setLastModified(now);
+            work.addPairing(pairings[i].get());
         }
 
         // m_rounds.at(i)->setPairings(pairings);
     }
 
+    if (const auto ok = work.flush(); !ok) {
+        qDebug() << "save pairings" << ok.error();
+        return ok;
+    }
+
     return {};
 }
 
@@ -937,11 +1189,53 @@ bool Tournament::isRoundFullyPaired(int round)
 
 QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> Tournament::calculatePairings(int round)
 {
-    auto engine = std::make_unique<PairingEngine>();
-    const auto pairings = co_await engine->pair(round, this);
+    PairingCache cache{m_event->statements(), m_id};
+    const auto key = PairingCache::key(PairingSnapshot::fromTournament(this, round), m_pairingSystem, m_pairingEngine);
 
-    if (!pairings.has_value()) {
-        co_return std::unexpected(pairings.error());
+    if (const auto speculative = m_speculation->result(key)) {
+        qDebug() << "Paired round" << round << "from the speculative pairings";
+        if (const auto ok = cache.insert(key, round, *speculative); !ok) {
+            qWarning() << "Could not store the pairings in the cache" << ok.error();
+        }
+        co_return *speculative;
+    }
+
+    if (const auto cached = cache.find(key); !cached) {
+        qWarning() << "Could not read the pairing cache" << cached.error();
+    } else if (cached->has_value()) {
+        qDebug() << "Paired round" << round << "from the pairing cache";
+        co_return **cached;
+    }
+
+    auto backend = PairingBackend::create(m_pairingSystem, m_pairingEngine);
+    auto pairings = co_await backend->pair(this, round);
+
+    const auto statistics = backend->statistics();
+    qDebug() << "Paired round" << round << "with" << backend->name() << "in" << statistics.elapsed.count() << "us,"
+             << statistics.solvedMatchings.value_or(-1) << "matchings solved";
+
+    if (!pairings) {
+        co_return pairings;
+    }
+
+    if (m_crossCheckPairings && m_pairingEngine == PairingEngine::BuiltIn) {
+        BbpPairingsBackend reference{m_pairingSystem};
+        auto expected = co_await reference.pair(this, round);
+
+        if (!expected) {
+            qWarning() << "Could not cross-check the pairings of round" << round << expected.error();
+        } else {
+            auto actual = *pairings;
+            std::ranges::sort(actual);
+            std::ranges::sort(*expected);
+            if (actual != *expected) {
+                qWarning() << "Pairings of round" << round << "differ from bbpPairings:" << actual << *expected;
+            }
+        }
+    }
+
+    if (const auto ok = cache.insert(key, round, *pairings); !ok) {
+        qWarning() << "Could not store the pairings in the cache" << ok.error();
     }
 
     co_return pairings;
@@ -962,7 +1256,8 @@ QCoro::Task<std::expected<bool, QString>> Tournament::pairNextRound()
     for (const auto &pairing : *pairings) {
         const auto &whitePlayer = players.value(pairing.first);
         Player *blackPlayer = nullptr;
-        Pairing::PartialResult whiteResult = Pairing::PartialResult::PairingBye;
+        // The player paired with the dummy of a round-robin does not score
+        Pairing::PartialResult whiteResult = isRoundRobin() ? Pairing::PartialResult::ZeroBye : Pairing::PartialResult::PairingBye;
 
         if (pairing.second != 0) {
             blackPlayer = players.value(pairing.second);
@@ -992,18 +1287,23 @@ std::expected<void, QString> Tournament::removePairing(int round, Pairing *pairi
     Q_ASSERT(pairing != nullptr);
     Q_ASSERT(!pairing->id().isEmpty());
 
-    QSqlQuery query(m_event->db());
-    query.prepare(DELETE_PAIRING_QUERY);
-    query.bindValue(":id"_L1, pairing->id());
+    auto query = m_event->statements().statement(DELETE_PAIRING_QUERY);
+    if (!query) {
+        return std::unexpected(query.error());
+    }
 
-    if (!query.exec()) {
-        return std::unexpected(query.lastError().text());
+    query->bindValue(":id"_L1, pairing->id());
+
+    if (!query->exec()) {
+        return std::unexpected(query->lastError().text());
     }
 
     m_rounds.at(round - 1)->removePairings([&pairing](Pairing *p) {
         return p->id() == pairing->id();
     });
 
+    clearHistory();
+
     return {};
 }
 
@@ -1013,17 +1313,16 @@ std::expected<void, QString> Tournament::removePairings(int round, bool keepByes
     Q_ASSERT(round <= m_numberOfRounds);
 
     for (size_t i = round; i <= m_rounds.size(); i++) {
-        QSqlQuery query(m_event->db());
-        if (keepByes) {
-            query.prepare(DELETE_PAIRINGS_KEEP_BYES_QUERY);
-        } else {
-            query.prepare(DELETE_PAIRINGS_QUERY);
+        auto query = m_event->statements().statement(keepByes ? DELETE_PAIRINGS_KEEP_BYES_QUERY : DELETE_PAIRINGS_QUERY);
+        if (!query) {
+            return std::unexpected(query.error());
         }
-        query.bindValue(u":round"_s, m_rounds.at(i - 1)->id());
 
-        if (!query.exec()) {
-            qDebug() << "remove pairings" << query.lastError();
-            return std::unexpected(query.lastError().text());
+        query->bindValue(u":round"_s, m_rounds.at(i - 1)->id());
+
+        if (!query->exec()) {
+            qDebug() << "remove pairings" << query->lastError();
+            return std::unexpected(query->lastError().text());
         }
 
         m_rounds.at(i - 1)->removePairings([keepByes](Pairing *pairing) {
@@ -1031,6 +1330,8 @@ std::expected<void, QString> Tournament::removePairings(int round, bool keepByes
         });
     }
 
+    clearHistory();
+
     setCurrentRound(round - 1);
 
     return {};
@@ -1042,12 +1343,15 @@ std::expected<void, QString> Tournament::deletePairings(Player *player)
     Q_ASSERT(player != nullptr);
     Q_ASSERT(!player->id().isEmpty());
 
-    QSqlQuery query(m_event->db());
-    query.prepare(DELETE_PAIRINGS_OF_PLAYER_QUERY);
-    query.bindValue(":id"_L1, player->id());
+    auto query = m_event->statements().statement(DELETE_PAIRINGS_OF_PLAYER_QUERY);
+    if (!query) {
+        return std::unexpected(query.error());
+    }
 
-    if (!query.exec()) {
-        return std::unexpected(query.lastError().text());
+    query->bindValue(":id"_L1, player->id());
+
+    if (!query->exec()) {
+        return std::unexpected(query->lastError().text());
     }
 
     for (auto &round : m_rounds) {
@@ -1056,6 +1360,8 @@ std::expected<void, QString> Tournament::deletePairings(Player *player)
         });
     }
 
+    clearHistory();
+
     return {};
 }
 
@@ -1066,7 +1372,34 @@ Tournament::InitialColor Tournament::initialColor()
 
 State Tournament::state(std::optional<int> maxRound)
 {
-    return State{this, maxRound};
+    const auto rounds = maxRound ? *maxRound : m_numberOfRounds;
+
+    QMutexLocker locker(&m_historyMutex);
+
+    if (m_history == nullptr || m_history->lastRound() != m_numberOfRounds) {
+        m_history = std::make_unique<State>(this);
+    }
+
+    if (rounds > m_history->lastRound()) {
+        return State{this, rounds};
+    }
+
+    return m_history->cutOff(rounds);
+}
+
+void Tournament::updateHistory(Pairing *pairing)
+{
+    QMutexLocker locker(&m_historyMutex);
+
+    if (m_history != nullptr && !m_history->update(pairing)) {
+        m_history.reset();
+    }
+}
+
+void Tournament::clearHistory()
+{
+    QMutexLocker locker(&m_historyMutex);
+    m_history.reset();
 }
 
 void Tournament::saveTiebreaks()
@@ -1085,14 +1418,18 @@ QVariant Tournament::option(const QString &name)
 
 void Tournament::setOption(const QString &name, const QVariant &value)
 {
-    QSqlQuery query(m_event->db());
-    query.prepare(UPDATE_OPTION_QUERY);
-    query.bindValue(u":tournament"_s, m_id);
-    query.bindValue(u":name"_s, name);
-    query.bindValue(u":value"_s, value);
+    auto query = m_event->statements().statement(UPDATE_OPTION_QUERY);
+    if (!query) {
+        qDebug() << "set option" << name << value << query.error();
+        return;
+    }
 
-    if (!query.exec()) {
-        qDebug() << "set option" << name << value << query.lastError();
+    query->bindValue(u":tournament"_s, m_id);
+    query->bindValue(u":name"_s, name);
+    query->bindValue(u":value"_s, value);
+
+    if (!query->exec()) {
+        qDebug() << "set option" << name << value << query->lastError();
         return;
     }
 
@@ -1154,6 +1491,8 @@ void Tournament::read(const QJsonObject &json)
             m_players.push_back(Player::fromJson(player.toObject()));
         }
     }
+
+    clearHistory();
 }
 
 std::expected<void, QString> Tournament::readTrf(QTextStream trf)
@@ -1275,6 +1614,16 @@ std::expected<void, QString> Tournament::loadOptions()
     setFederation(option(u"federation"_s).toString());
     setNumberOfRounds(option(u"number_of_rounds"_s).toInt());
     setCurrentRound(option(u"current_round"_s).toInt());
+    setPairingSystem(Tournament::PairingSystem(option(u"pairing_system"_s).toInt()));
+    setPairingEngine(Tournament::PairingEngine(option(u"pairing_engine"_s).toInt()));
+    setCrossCheckPairings(option(u"cross_check_pairings"_s).toBool());
+    setSpeculativePairing(option(u"speculative_pairing"_s).toBool());
+    if (const auto threads = option(u"speculative_pairing_threads"_s); threads.isValid()) {
+        setSpeculativePairingThreads(threads.toInt());
+    }
+    if (const auto scenarios = option(u"speculative_pairing_scenarios"_s); scenarios.isValid()) {
+        setSpeculativePairingScenarios(scenarios.toInt());
+    }
     setInitialColor(Tournament::InitialColor(option(u"initial_color"_s).toInt()));
 
     return {};
@@ -10,14 +10,15 @@
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <QMutex>
 #include <QObject>
 #include <QString>
 #include <QTextStream>
+#include <QThreadPool>
 
 #include <expected>
 
 #include "arbiter.h"
-#include "pairingengine.h"
 #include "player.h"
 #include "round.h"
 #include "standing.h"
@@ -28,6 +29,9 @@
 
 class Document;
 class Event;
+class SpeculativePairing;
+class State;
+class UnitOfWork;
 
 using namespace Qt::StringLiterals;
 
@@ -52,7 +56,17 @@ class Tournament : public QObject
     Q_PROPERTY(int numberOfRounds READ numberOfRounds WRITE setNumberOfRounds NOTIFY numberOfRoundsChanged)
     Q_PROPERTY(int currentRound READ currentRound WRITE setCurrentRound NOTIFY currentRoundChanged)
 
+    Q_PROPERTY(PairingSystem pairingSystem READ pairingSystem WRITE setPairingSystem NOTIFY pairingSystemChanged)
+    Q_PROPERTY(PairingEngine pairingEngine READ pairingEngine WRITE setPairingEngine NOTIFY pairingEngineChanged)
+    Q_PROPERTY(bool crossCheckPairings READ crossCheckPairings WRITE setCrossCheckPairings NOTIFY crossCheckPairingsChanged)
+    Q_PROPERTY(bool speculativePairing READ speculativePairing WRITE setSpeculativePairing NOTIFY speculativePairingChanged)
+    Q_PROPERTY(int speculativePairingThreads READ speculativePairingThreads WRITE setSpeculativePairingThreads NOTIFY speculativePairingThreadsChanged)
+    Q_PROPERTY(
+        int speculativePairingScenarios READ speculativePairingScenarios WRITE setSpeculativePairingScenarios NOTIFY speculativePairingScenariosChanged)
+
 public:
+    ~Tournament() override;
+
     /*!
      * \property Tournament::id
      * \brief the ID of the tournament
@@ -117,6 +131,98 @@ public:
      */
     [[nodiscard]] int currentRound() const;
 
+    /*!
+     * \enum Tournament::PairingSystem
+     *
+     * This enum type represents the system used to pair the rounds.
+     *
+     * \value Dutch FIDE Dutch system.
+     * \value Burstein FIDE Burstein system.
+     * \value Dubov FIDE Dubov system.
+     * \value Lim FIDE Lim system.
+     * \value RoundRobin Round-robin paired with the FIDE Berger tables.
+     * \value DoubleRoundRobin Double round-robin paired with the FIDE Berger
+     * tables, the second cycle with the colors reversed.
+     */
+    enum class PairingSystem {
+        Dutch,
+        Burstein,
+        Dubov,
+        Lim,
+        RoundRobin,
+        DoubleRoundRobin,
+    };
+    Q_ENUM(PairingSystem);
+
+    /*!
+     * \enum Tournament::PairingEngine
+     *
+     * This enum type represents the implementation used to compute the pairings.
+     *
+     * \value BuiltIn The built-in pairing engine.
+     * \value BbpPairings The external bbpPairings program. Only the Dutch and
+     * Burstein systems are supported.
+     */
+    enum class PairingEngine {
+        BuiltIn,
+        BbpPairings,
+    };
+    Q_ENUM(PairingEngine);
+
+    /*!
+     * \property Tournament::pairingSystem
+     * \brief the pairing system of the tournament
+     */
+    [[nodiscard]] PairingSystem pairingSystem() const;
+
+    /*!
+     * Returns whether the tournament is paired as a round-robin.
+     */
+    [[nodiscard]] bool isRoundRobin() const;
+
+    /*!
+     * \property Tournament::pairingEngine
+     * \brief the implementation used to compute the pairings
+     *
+     * \sa PairingBackend
+     */
+    [[nodiscard]] PairingEngine pairingEngine() const;
+
+    /*!
+     * \property Tournament::crossCheckPairings
+     * \brief whether to compare the pairings with the ones from bbpPairings
+     *
+     * When enabled, the pairings generated by the built-in engine are compared with the
+     * pairings generated by bbpPairings, and any difference is logged.
+     */
+    [[nodiscard]] bool crossCheckPairings() const;
+
+    /*!
+     * \property Tournament::speculativePairing
+     * \brief whether to pair the next round while the last games are being played
+     *
+     * When enabled and only a few games of the current round are pending, the
+     * pairings of the next round are computed in the background for every
+     * combination of their results. Only the built-in engine is supported.
+     *
+     * \sa SpeculativePairing
+     */
+    [[nodiscard]] bool speculativePairing() const;
+
+    /*!
+     * \property Tournament::speculativePairingThreads
+     * \brief the maximum number of threads used by speculative pairing
+     */
+    [[nodiscard]] int speculativePairingThreads() const;
+
+    /*!
+     * \property Tournament::speculativePairingScenarios
+     * \brief the maximum number of result combinations paired speculatively
+     *
+     * Each combination keeps one set of pairings in memory.
+     */
+    [[nodiscard]] int speculativePairingScenarios() const;
+
     [[nodiscard]] Event *getEvent() const;
 
     /*!
@@ -172,10 +278,38 @@ public:
     /*
      * Returns the standings of the tournament.
      *
+     * The tiebreaks of the players are calculated in parallel, so the tiebreaks
+     * must not modify the tournament.
+     *
      * \a state Helper object to compute the standings.
      */
     QList<Standing> standings(const State &state);
 
+    /*!
+     * Returns the standings of the tournament using \a tiebreaks, usually a copy of
+     * Tiebreaks::compiled().
+     *
+     * This is the overload to use from other threads: the tiebreaks of the
+     * tournament may change while the standings are computed, but the copy keeps
+     * its tiebreaks alive.
+     */
+    QList<Standing> standings(const State &state, const std::vector<std::shared_ptr<Tiebreak>> &tiebreaks);
+
+    /*!
+     * Returns the standings after each round up to \a maxRound. The standings after
+     * round r are at index r - 1.
+     *
+     * The games are read once, and the aggregates of every round, like the
+     * Buchholz of the players, are carried forward from the round before it.
+     */
+    QList<QList<Standing>> standingsHistory(std::optional<int> maxRound = std::nullopt);
+
+    /*!
+     * Returns the standings after each round up to \a maxRound using \a tiebreaks,
+     * usually a copy of Tiebreaks::compiled(), so it can run in other threads.
+     */
+    QList<QList<Standing>> standingsHistory(std::optional<int> maxRound, const std::vector<std::shared_ptr<Tiebreak>> &tiebreaks);
+
     Q_INVOKABLE QList<QVariantMap> availableTiebreaks();
 
     std::expected<void, QString> setTiebreaksFromTrf(const QString &line);
@@ -242,6 +376,12 @@ public:
      */
     bool isRoundFullyPaired(int round);
 
+    /*!
+     * Returns the pairings for \a round as pairs of starting ranks (white, black).
+     *
+     * The pairings are computed by the backend selected by pairingSystem and
+     * pairingEngine. The player receiving the pairing-allocated bye is paired with 0.
+     */
     QCoro::Task<std::expected<QList<std::pair<uint, uint>>, QString>> calculatePairings(int round);
 
     /*!
@@ -285,6 +425,9 @@ public:
      * Returns a helper object.
      *
      * \a maxRound The number of the highest round to include.
+     *
+     * The games of all the rounds are read once and kept up to date as results
+     * change, so the state after any round is a cheap view of them.
      */
     State state(std::optional<int> maxRound = std::nullopt);
 
@@ -380,6 +523,12 @@ public Q_SLOTS:
     void setFederation(const QString &federation);
     void setNumberOfRounds(int numberOfRounds);
     void setCurrentRound(int currentRound);
+    void setPairingSystem(Tournament::PairingSystem pairingSystem);
+    void setPairingEngine(Tournament::PairingEngine pairingEngine);
+    void setCrossCheckPairings(bool crossCheckPairings);
+    void setSpeculativePairing(bool speculativePairing);
+    void setSpeculativePairingThreads(int threads);
+    void setSpeculativePairingScenarios(int scenarios);
 
     void setInitialColor(Tournament::InitialColor color);
 
@@ -393,6 +542,17 @@ Q_SIGNALS:
     void numberOfRatedPlayersChanged();
     void numberOfRoundsChanged();
     void currentRoundChanged();
+    void pairingSystemChanged();
+    void pairingEngineChanged();
+    void crossCheckPairingsChanged();
+    void speculativePairingChanged();
+    void speculativePairingThreadsChanged();
+    void speculativePairingScenariosChanged();
+
+    /*!
+     * This signal is emitted after the result of \a pairing changes.
+     */
+    void resultChanged(Pairing *pairing);
 
 private:
     explicit Tournament(Event *event);
@@ -407,6 +567,12 @@ private:
     std::expected<void, QString> loadArbiters();
     std::expected<void, QString> loadTimeControl();
 
+    void updateHistory(Pairing *pairing);
+    void clearHistory();
+
+    // Saves the players of work, and notifies that they changed
+    std::expected<void, QString> savePlayers(UnitOfWork &work);
+
     Event *m_event;
 
     QString m_id;
@@ -417,12 +583,26 @@ private:
     TimeControl m_timeControl;
     int m_numberOfRounds = 1;
     int m_currentRound = 0;
+    PairingSystem m_pairingSystem = PairingSystem::Dutch;
+    PairingEngine m_pairingEngine = PairingEngine::BuiltIn;
+    bool m_crossCheckPairings = false;
+    bool m_speculativePairing = false;
+    int m_speculativePairingThreads = 2;
+    int m_speculativePairingScenarios = 243;
+    SpeculativePairing *m_speculation;
     QVariantMap m_options;
     Tiebreaks m_tiebreaks;
 
     std::vector<std::unique_ptr<Player>> m_players;
     std::vector<std::unique_ptr<Round>> m_rounds;
 
+    // State of all the rounds, shared by the states returned by state()
+    std::unique_ptr<State> m_history;
+    QMutex m_historyMutex;
+
+    // Calculates the tiebreaks of the standings
+    QThreadPool m_standingsPool;
+
     Tournament::InitialColor m_initialColor;
 
     friend class Event;
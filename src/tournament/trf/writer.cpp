@@ -75,7 +75,7 @@ void TrfWriter::writeArbiters(QTextStream &stream)
 void TrfWriter::writeTiebreaks(QTextStream &stream)
 {
     QStringList codes{};
-    for (const auto &tiebreak : m_tournament->tiebreaks().all()) {
+    for (const auto &tiebreak : m_tournament->tiebreaks().compiled()) {
         const auto code = tiebreak->code();
         if (!code.isEmpty()) {
             codes << code;
@@ -108,14 +108,14 @@ void TrfWriter::writePlayers(QTextStream &stream)
             return s.player() == player;
         });
         const auto rank = std::distance(standings.constBegin(), standing) + 1;
-        const auto result = player->toTrf(m_state.points(player), static_cast<int>(rank));
+        const auto index = State::index(player);
+        const auto result = player->toTrf(m_state.points(index), static_cast<int>(rank));
 
         stream << result.c_str();
 
-        const auto pairings = m_state.pairings(player);
         for (int i = 0; i < m_state.lastRound(); i++) {
-            if (i < pairings.size()) {
-                stream << pairings.value(i)->toTrf(player);
+            if (const auto pairing = m_state.pairing(index, i); pairing != nullptr) {
+                stream << pairing->toTrf(player);
             } else {
                 stream << "          "_L1;
             }
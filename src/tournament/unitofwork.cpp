@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "unitofwork.h"
+
+#include <QSqlError>
+
+#include <utility>
+
+#include "db.h"
+#include "pairing.h"
+#include "player.h"
+#include "round.h"
+
+UnitOfWork::UnitOfWork(StatementCache &statements, const QString &tournament)
+    : m_statements(statements)
+    , m_tournament(tournament)
+{
+}
+
+void UnitOfWork::addPlayer(Player *player)
+{
+    Q_ASSERT(player != nullptr);
+
+    m_players << player;
+}
+
+void UnitOfWork::addPairing(Pairing *pairing)
+{
+    Q_ASSERT(pairing != nullptr);
+    Q_ASSERT(!pairing->id().isEmpty());
+
+    m_pairings << pairing;
+}
+
+void UnitOfWork::addRound(Round *round)
+{
+    Q_ASSERT(round != nullptr);
+
+    m_rounds << round;
+}
+
+bool UnitOfWork::isEmpty() const
+{
+    return m_players.isEmpty() && m_pairings.isEmpty() && m_rounds.isEmpty();
+}
+
+std::expected<void, QString> UnitOfWork::flush()
+{
+    if (isEmpty()) {
+        return {};
+    }
+
+    auto db = m_statements.database();
+
+    if (!db.transaction()) {
+        return std::unexpected(db.lastError().text());
+    }
+
+    if (const auto ok = write(); !ok) {
+        db.rollback();
+        return ok;
+    }
+
+    if (!db.commit()) {
+        const auto error = db.lastError().text();
+        db.rollback();
+        return std::unexpected(error);
+    }
+
+    return {};
+}
+
+std::expected<void, QString> UnitOfWork::write()
+{
+    if (const auto ok = writePlayers(); !ok) {
+        return ok;
+    }
+
+    if (const auto ok = writePairings(); !ok) {
+        return ok;
+    }
+
+    if (const auto ok = writeRounds(); !ok) {
+        return ok;
+    }
+
+    clear();
+
+    return {};
+}
+
+void UnitOfWork::bindPairing(StatementCache::Statement &query, const Pairing *pairing)
+{
+    query.bindValue(u":id"_s, pairing->id());
+    query.bindValue(u":board"_s, pairing->board());
+    query.bindValue(u":whitePlayer"_s, pairing->whitePlayer()->id());
+    if (pairing->blackPlayer() != nullptr) {
+        query.bindValue(u":blackPlayer"_s, pairing->blackPlayer()->id());
+    } else {
+        query.bindValue(u":blackPlayer"_s, QVariant(QMetaType::fromType<QString>()));
+    }
+    query.bindValue(u":whiteResult"_s, std::to_underlying(pairing->whiteResult()));
+    query.bindValue(u":blackResult"_s, std::to_underlying(pairing->blackResult()));
+    query.bindValue(u":lastModified"_s, pairing->lastModified().toSecsSinceEpoch());
+    query.bindValue(u":extra"_s, pairing->extraString());
+}
+
+void UnitOfWork::clear()
+{
+    m_players.clear();
+    m_pairings.clear();
+    m_rounds.clear();
+}
+
+std::expected<void, QString> UnitOfWork::writePlayers()
+{
+    if (m_players.isEmpty()) {
+        return {};
+    }
+
+    auto query = m_statements.statement(UPDATE_PLAYER_QUERY);
+    if (!query) {
+        return std::unexpected(query.error());
+    }
+
+    for (const auto player : std::as_const(m_players)) {
+        query->bindValue(u":id"_s, player->id());
+        query->bindValue(u":startingRank"_s, player->startingRank());
+        query->bindValue(u":title"_s, player->title());
+        query->bindValue(u":name"_s, player->name());
+        query->bindValue(u":rating"_s, player->rating());
+        query->bindValue(u":nationalRating"_s, player->nationalRating());
+        query->bindValue(u":playerId"_s, player->playerId());
+        query->bindValue(u":nationalId"_s, player->nationalId());
+        query->bindValue(u":birthDate"_s, player->birthDate());
+        query->bindValue(u":federation"_s, player->federation());
+        query->bindValue(u":origin"_s, player->origin());
+        query->bindValue(u":gender"_s, player->gender());
+        query->bindValue(u":extra"_s, player->extraString());
+        query->bindValue(u":tournament"_s, m_tournament);
+
+        if (!query->exec()) {
+            return std::unexpected(query->lastError().text());
+        }
+    }
+
+    return {};
+}
+
+std::expected<void, QString> UnitOfWork::writePairings()
+{
+    if (m_pairings.isEmpty()) {
+        return {};
+    }
+
+    auto query = m_statements.statement(UPDATE_PAIRING_QUERY);
+    if (!query) {
+        return std::unexpected(query.error());
+    }
+
+    for (const auto pairing : std::as_const(m_pairings)) {
+        bindPairing(*query, pairing);
+
+        if (!query->exec()) {
+            return std::unexpected(query->lastError().text());
+        }
+    }
+
+    return {};
+}
+
+std::expected<void, QString> UnitOfWork::writeRounds()
+{
+    if (m_rounds.isEmpty()) {
+        return {};
+    }
+
+    auto query = m_statements.statement(UPDATE_ROUND_QUERY);
+    if (!query) {
+        return std::unexpected(query.error());
+    }
+
+    for (const auto round : std::as_const(m_rounds)) {
+        query->bindValue(u":id"_s, round->id());
+        query->bindValue(u":datetime"_s, round->dateTime().toUTC().toString(Qt::ISODate));
+        query->bindValue(u":extra"_s, round->extraString());
+
+        if (!query->exec()) {
+            return std::unexpected(query->lastError().text());
+        }
+    }
+
+    return {};
+}
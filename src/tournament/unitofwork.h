@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2026 Manuel Alcaraz Zambrano <manuel@alcarazzam.dev>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QSet>
+#include <QString>
+
+#include <expected>
+
+#include "statementcache.h"
+
+class Pairing;
+class Player;
+class Round;
+
+/*!
+ * \class UnitOfWork
+ * \inmodule tournament
+ * \inheaderfile tournament/unitofwork.h
+ *
+ * \brief Collects the modified players, pairings and rounds of a tournament and
+ * saves them at once.
+ *
+ * Every kind of object is saved with a single prepared statement of the
+ * StatementCache, which is bound again for each object. flush() saves everything
+ * in one transaction, so changes touching many rows, like sorting the players,
+ * only commit once.
+ *
+ * The objects must already exist in the database, and must outlive the unit of
+ * work.
+ */
+class UnitOfWork
+{
+public:
+    explicit UnitOfWork(StatementCache &statements, const QString &tournament);
+
+    /*!
+     * Marks \a player as modified.
+     */
+    void addPlayer(Player *player);
+
+    /*!
+     * Marks \a pairing as modified.
+     */
+    void addPairing(Pairing *pairing);
+
+    /*!
+     * Marks \a round as modified.
+     */
+    void addRound(Round *round);
+
+    /*!
+     * Returns whether there are no modified objects.
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /*!
+     * Saves the modified objects in a single transaction.
+     *
+     * If any of them can't be saved the transaction is rolled back, and the
+     * objects are kept so the flush can be retried.
+     */
+    std::expected<void, QString> flush();
+
+    /*!
+     * Saves the modified objects in the transaction already open in the database,
+     * if any.
+     */
+    std::expected<void, QString> write();
+
+    /*!
+     * Forgets all the modified objects without saving them.
+     */
+    void clear();
+
+    /*!
+     * Binds the columns of \a pairing shared by the statements that add and
+     * update pairings to \a query.
+     */
+    static void bindPairing(StatementCache::Statement &query, const Pairing *pairing);
+
+private:
+    std::expected<void, QString> writePlayers();
+    std::expected<void, QString> writePairings();
+    std::expected<void, QString> writeRounds();
+
+    StatementCache &m_statements;
+    QString m_tournament;
+
+    QSet<Player *> m_players;
+    QSet<Pairing *> m_pairings;
+    QSet<Round *> m_rounds;
+};